@@ -0,0 +1,161 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+// Compares WheelTimer with one GSource per timer which RunningApp used before TimerWheel.
+//
+// usage) sam-timer-benchmark [timers]
+//
+// start/stop : all timers are started and stopped before they are expired (app is closed in time)
+// idle loop  : main loop iterations while all timers are pending. Each GSource is polled in each iteration
+// expire     : all timers are expired (app is killed). 'late' is the worst delay after its deadline
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <vector>
+#include <glib.h>
+
+#include "util/TimerWheel.h"
+
+using namespace std;
+
+static const guint LONG_TIMEOUT = 60000;
+static const guint LOOP_ITERATIONS = 1000;
+
+struct Expiry {
+    gint64 deadline;
+    int* remaining;
+    gint64* late;
+};
+
+static gboolean onExpired(gpointer data)
+{
+    Expiry* expiry = static_cast<Expiry*>(data);
+    gint64 late = g_get_monotonic_time() - expiry->deadline;
+    if (late > *(expiry->late))
+        *(expiry->late) = late;
+    (*(expiry->remaining))--;
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean onNothing(gpointer data)
+{
+    return G_SOURCE_REMOVE;
+}
+
+static double toMs(gint64 us)
+{
+    return us / 1000.0;
+}
+
+static double cpuMs(clock_t begin)
+{
+    return (clock() - begin) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static void runIdleLoop()
+{
+    for (guint i = 0; i < LOOP_ITERATIONS; ++i)
+        g_main_context_iteration(NULL, FALSE);
+}
+
+static void benchmarkGSource(int count)
+{
+    vector<guint> sources(count);
+
+    gint64 begin = g_get_monotonic_time();
+    for (int i = 0; i < count; ++i)
+        sources[i] = g_timeout_add(LONG_TIMEOUT, onNothing, nullptr);
+    for (int i = 0; i < count; ++i)
+        g_source_remove(sources[i]);
+    printf("GSource     start/stop %10.3f ms\n", toMs(g_get_monotonic_time() - begin));
+
+    for (int i = 0; i < count; ++i)
+        sources[i] = g_timeout_add(LONG_TIMEOUT, onNothing, nullptr);
+    begin = g_get_monotonic_time();
+    runIdleLoop();
+    printf("GSource     idle loop  %10.3f ms\n", toMs(g_get_monotonic_time() - begin));
+    for (int i = 0; i < count; ++i)
+        g_source_remove(sources[i]);
+
+    int remaining = count;
+    gint64 late = 0;
+    vector<Expiry> expiries(count);
+    clock_t cpu = clock();
+    for (int i = 0; i < count; ++i) {
+        guint timeout = 1000 + (i % 10) * 100;
+        expiries[i] = { g_get_monotonic_time() + timeout * 1000, &remaining, &late };
+        g_timeout_add(timeout, onExpired, &expiries[i]);
+    }
+    while (remaining > 0)
+        g_main_context_iteration(NULL, TRUE);
+    printf("GSource     expire     %10.3f ms cpu, late %.3f ms\n", cpuMs(cpu), toMs(late));
+}
+
+static void benchmarkWheelTimer(int count)
+{
+    vector<WheelTimer*> timers(count);
+    for (int i = 0; i < count; ++i)
+        timers[i] = new WheelTimer(onNothing, nullptr);
+
+    gint64 begin = g_get_monotonic_time();
+    for (int i = 0; i < count; ++i)
+        timers[i]->start(LONG_TIMEOUT);
+    for (int i = 0; i < count; ++i)
+        timers[i]->stop();
+    printf("WheelTimer  start/stop %10.3f ms\n", toMs(g_get_monotonic_time() - begin));
+
+    for (int i = 0; i < count; ++i)
+        timers[i]->start(LONG_TIMEOUT);
+    begin = g_get_monotonic_time();
+    runIdleLoop();
+    printf("WheelTimer  idle loop  %10.3f ms\n", toMs(g_get_monotonic_time() - begin));
+    for (int i = 0; i < count; ++i)
+        delete timers[i];
+
+    int remaining = count;
+    gint64 late = 0;
+    vector<Expiry> expiries(count);
+    clock_t cpu = clock();
+    for (int i = 0; i < count; ++i) {
+        guint timeout = 1000 + (i % 10) * 100;
+        expiries[i] = { g_get_monotonic_time() + timeout * 1000, &remaining, &late };
+        timers[i] = new WheelTimer(onExpired, &expiries[i]);
+        timers[i]->start(timeout);
+    }
+    while (remaining > 0)
+        g_main_context_iteration(NULL, TRUE);
+    printf("WheelTimer  expire     %10.3f ms cpu, late %.3f ms\n", cpuMs(cpu), toMs(late));
+    for (int i = 0; i < count; ++i)
+        delete timers[i];
+}
+
+int main(int argc, char* argv[])
+{
+    int count = 1000;
+    if (argc > 1)
+        count = atoi(argv[1]);
+    if (count <= 0) {
+        fprintf(stderr, "usage: %s [timers]\n", argv[0]);
+        return 1;
+    }
+
+    printf("timers(%d)\n", count);
+    benchmarkGSource(count);
+    benchmarkWheelTimer(count);
+    return 0;
+}
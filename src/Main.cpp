@@ -22,6 +22,7 @@
 #include <gio/gio.h>
 
 #include "MainDaemon.h"
+#include "util/BootTimeline.h"
 #include "util/Logger.h"
 #include "util/File.h"
 
@@ -63,6 +64,8 @@ Done:
 int main(int argc, char **argv)
 {
     Logger::info(CLASS_NAME, __FUNCTION__, "Start SAM process");
+    // all timestamps of boot timeline are relative to this point
+    BootTimeline::getInstance().mark("main");
 
     // tracking sender if we get some signal
     struct sigaction act;
@@ -25,7 +25,10 @@
 #include <glib.h>
 #include <boost/bind.hpp>
 
+#include "base/AppCatalogCache.h"
 #include "base/AppDescriptionList.h"
+#include "base/AppDirectoryWatcher.h"
+#include "base/RecentList.h"
 #include "bus/client/AppInstallService.h"
 #include "bus/client/Bootd.h"
 #include "bus/client/Configd.h"
@@ -37,15 +40,18 @@
 #include "bus/client/SettingService.h"
 #include "bus/client/WAM.h"
 #include "bus/service/ApplicationManager.h"
+#include "bus/service/SchemaChecker.h"
 #include "conf/RuntimeInfo.h"
 #include "conf/SAMConf.h"
+#include "util/BootTimeline.h"
 #include "util/File.h"
 #include "util/JValueUtil.h"
 
 
 MainDaemon::MainDaemon()
     : m_isCBDGenerated(false),
-      m_isConfigsReceived(false)
+      m_isConfigsReceived(false),
+      m_isFullyScanned(false)
 {
     setClassName("MainDaemon");
     m_mainLoop = g_main_loop_new(NULL, FALSE);
@@ -60,13 +66,37 @@ MainDaemon::~MainDaemon()
 
 void MainDaemon::initialize()
 {
+    BootTimeline::getInstance().begin("RuntimeInfo");
     RuntimeInfo::getInstance().initialize();
+    BootTimeline::getInstance().end("RuntimeInfo");
+    BootTimeline::getInstance().begin("SAMConf");
     SAMConf::getInstance().initialize();
-    AppDescriptionList::getInstance().scanFull();
-
+    BootTimeline::getInstance().end("SAMConf");
+    BootTimeline::getInstance().begin("AppCatalogCache");
+    AppCatalogCache::getInstance().initialize();
+    BootTimeline::getInstance().end("AppCatalogCache");
+    RecentList::getInstance().initialize();
+
+    AppDescriptionList::getInstance().EventFullyScanned.connect(boost::bind(&MainDaemon::onFullyScanned, this));
+    if (SAMConf::getInstance().isStagedScanEnabled())
+        AppDescriptionList::getInstance().scanCritical();
+    else
+        AppDescriptionList::getInstance().scanFull();
+
+    BootTimeline::getInstance().begin("SchemaChecker");
+    SchemaChecker::getInstance().initialize();
+    BootTimeline::getInstance().end("SchemaChecker");
+    BootTimeline::getInstance().begin("attach");
     if (!ApplicationManager::getInstance().attach(m_mainLoop))
         return;
+    BootTimeline::getInstance().end("attach");
+
+    // Remaining apps are scanned after service is registered
+    AppDescriptionList::getInstance().scanRemaining();
+
+    AppDirectoryWatcher::getInstance().initialize();
 
+    BootTimeline::getInstance().begin("clients");
     AppInstallService::getInstance().initialize();
     Bootd::getInstance().initialize();
     Configd::getInstance().initialize();
@@ -77,13 +107,17 @@ void MainDaemon::initialize()
     Notification::getInstance().initialize();
     SettingService::getInstance().initialize();
     WAM::getInstance().initialize();
+    BootTimeline::getInstance().end("clients");
 
     Bootd::getInstance().EventGetBootStatus.connect(boost::bind(&MainDaemon::onGetBootStatus, this, boost::placeholders::_1));
     Configd::getInstance().EventGetConfigs.connect(boost::bind(&MainDaemon::onGetConfigs, this, boost::placeholders::_1));
+    LSM::getInstance().EventRecentsAppListChanged.connect(boost::bind(&MainDaemon::onRecentsAppListChanged, this, boost::placeholders::_1));
 }
 
 void MainDaemon::finalize()
 {
+    AppDirectoryWatcher::getInstance().finalize();
+    RecentList::getInstance().finalize();
     AppInstallService::getInstance().finalize();
     Bootd::getInstance().finalize();
     Configd::getInstance().finalize();
@@ -116,9 +150,24 @@ void MainDaemon::onGetBootStatus(const JValue& subscriptionPayload)
         return;
     }
     m_isCBDGenerated = true;
+    BootTimeline::getInstance().mark("Bootd:core-boot-done");
+    checkPreconditions();
+}
+
+void MainDaemon::onFullyScanned()
+{
+    // restored recents can have apps which are uninstalled while SAM is not running
+    RecentList::getInstance().prune();
+    ApplicationManager::getInstance().launchPendings();
+    m_isFullyScanned = true;
     checkPreconditions();
 }
 
+void MainDaemon::onRecentsAppListChanged(const JValue& delta)
+{
+    ApplicationManager::getInstance().postListRecents(delta);
+}
+
 void MainDaemon::onGetConfigs(const JValue& responsePayload)
 {
     JValue sysAssetFallbackPrecedence;
@@ -126,12 +175,14 @@ void MainDaemon::onGetConfigs(const JValue& responsePayload)
     JValue lifeCycle;
 
     if (JValueUtil::getValue(responsePayload, "configs", "system.sysAssetFallbackPrecedence", sysAssetFallbackPrecedence) && sysAssetFallbackPrecedence.isArray()) {
-        SAMConf::getInstance().setSysAssetFallbackPrecedence(sysAssetFallbackPrecedence);
+        if (SAMConf::getInstance().setSysAssetFallbackPrecedence(sysAssetFallbackPrecedence))
+            AppDescriptionList::getInstance().changeSysAssetFallbackPrecedence();
     }
     if (JValueUtil::getValue(responsePayload, "configs", "com.webos.applicationManager.keepAliveApps", keepAliveApps) && keepAliveApps.isArray()) {
         SAMConf::getInstance().setKeepAliveApps(keepAliveApps);
     }
     m_isConfigsReceived = true;
+    BootTimeline::getInstance().mark("Configd:getConfigs");
     checkPreconditions();
 }
 
@@ -149,9 +200,16 @@ void MainDaemon::checkPreconditions()
         Logger::info(getClassName(), __FUNCTION__, "Wait for receiving 'getBootStatus' response");
         return;
     }
+    if (!m_isFullyScanned) {
+        Logger::info(getClassName(), __FUNCTION__, "Wait for scanning all applications");
+        return;
+    }
     Logger::info(getClassName(), __FUNCTION__, "All initial components are ready");
     isFired = true;
 
+    BootTimeline::getInstance().begin("enablePosting");
     ApplicationManager::getInstance().enablePosting();
+    BootTimeline::getInstance().end("enablePosting");
+    BootTimeline::getInstance().complete(SAMConf::getInstance().getBootTimelinePath());
 }
 
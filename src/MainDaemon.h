@@ -40,11 +40,14 @@ private:
 
     void onGetBootStatus(const JValue& subscriptionPayload);
     void onGetConfigs(const JValue& subscriptionPayload);
+    void onFullyScanned();
+    void onRecentsAppListChanged(const JValue& delta);
 
     void checkPreconditions();
 
     bool m_isCBDGenerated;
     bool m_isConfigsReceived;
+    bool m_isFullyScanned;
 
     GMainLoop *m_mainLoop;
 
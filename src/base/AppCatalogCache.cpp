@@ -0,0 +1,489 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "base/AppCatalogCache.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <set>
+
+#include "conf/RuntimeInfo.h"
+#include "conf/SAMConf.h"
+#include "util/File.h"
+#include "util/JValueUtil.h"
+#include "util/Logger.h"
+
+// Layout (native endian)
+// header : MAGIC(8) VERSION(u32) localeKey(str) fallbackKey(str) count(u32)
+// entry  : folderPath(str) appLocation(u8) flags(u8) signatureCount(u32) signature* appinfo(str)
+// signature : path(str) ino(u64) size(i64) mtimeSec(i64) mtimeNsec(i64)
+// str    : length(u32) bytes
+const char* AppCatalogCache::MAGIC = "SAMCATLG";
+const uint32_t AppCatalogCache::VERSION = 3;
+
+namespace {
+
+class Reader {
+public:
+    Reader(const char* data, size_t length)
+        : m_data(data), m_length(length), m_offset(0)
+    {
+    }
+
+    template <typename T>
+    bool read(T& value)
+    {
+        if (m_length - m_offset < sizeof(T))
+            return false;
+        memcpy(&value, m_data + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    bool read(const char*& str, size_t& length)
+    {
+        uint32_t len = 0;
+        if (!read(len) || m_length - m_offset < len)
+            return false;
+        str = m_data + m_offset;
+        length = len;
+        m_offset += len;
+        return true;
+    }
+
+    bool read(string& str)
+    {
+        const char* ptr = NULL;
+        size_t len = 0;
+        if (!read(ptr, len))
+            return false;
+        str.assign(ptr, len);
+        return true;
+    }
+
+private:
+    const char* m_data;
+    size_t m_length;
+    size_t m_offset;
+};
+
+template <typename T>
+void append(string& buffer, const T& value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void append(string& buffer, const char* str, size_t length)
+{
+    append(buffer, (uint32_t) length);
+    buffer.append(str, length);
+}
+
+void append(string& buffer, const string& str)
+{
+    append(buffer, str.c_str(), str.length());
+}
+
+}
+
+void AppCatalogCache::makeSignature(const string& path, Signature& signature)
+{
+    struct stat st;
+    signature.path = path;
+    if (stat(path.c_str(), &st) != 0) {
+        // not existing file is also valid signature
+        signature.ino = 0;
+        signature.size = -1;
+        signature.mtimeSec = 0;
+        signature.mtimeNsec = 0;
+        return;
+    }
+    signature.ino = (uint64_t) st.st_ino;
+    signature.size = (int64_t) st.st_size;
+    signature.mtimeSec = (int64_t) st.st_mtim.tv_sec;
+    signature.mtimeNsec = (int64_t) st.st_mtim.tv_nsec;
+}
+
+bool AppCatalogCache::isUnchanged(const vector<Signature>& signatures)
+{
+    Signature current;
+    for (const auto& signature : signatures) {
+        makeSignature(signature.path, current);
+        if (!(current == signature))
+            return false;
+    }
+    return true;
+}
+
+AppCatalogCache::AppCatalogCache()
+    : m_mapped(NULL),
+      m_mappedLength(0),
+      m_isDirty(false),
+      m_hitCount(0),
+      m_missCount(0)
+{
+    setClassName("AppCatalogCache");
+}
+
+AppCatalogCache::~AppCatalogCache()
+{
+    unload();
+}
+
+void AppCatalogCache::initialize()
+{
+    if (!RuntimeInfo::getInstance().getHome().empty()) {
+        m_path = RuntimeInfo::getInstance().getHome() + "/.config/sam-appcatalog.cache";
+    } else {
+        m_path = SAMConf::getInstance().getAppCatalogCachePath();
+    }
+    m_localeKey = makeLocaleKey();
+    m_fallbackKey = makeFallbackKey();
+
+    if (!load()) {
+        Logger::info(getClassName(), __FUNCTION__, m_path, "Cache is not available. Full scanning is needed");
+        unload();
+        m_isDirty = true;
+        return;
+    }
+    Logger::info(getClassName(), __FUNCTION__, m_path, Logger::format("entries(%d)", (int) m_entries.size()));
+}
+
+bool AppCatalogCache::lookup(const string& folderPath, const AppLocation& appLocation, JValue& appinfo, bool& isLocalized, bool& hasSysAssets)
+{
+    vector<Signature> signatures;
+    string serialized;
+    uint8_t flags = 0;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        checkKey();
+
+        auto it = m_entries.find(folderPath);
+        if (it == m_entries.end() || it->second.appLocation != appLocation) {
+            m_missCount++;
+            return false;
+        }
+        signatures = it->second.signatures;
+        flags = it->second.flags;
+        if (it->second.appinfo)
+            serialized.assign(it->second.appinfo, it->second.appinfoLength);
+        else
+            serialized = it->second.stored;
+    }
+
+    if (!isUnchanged(signatures)) {
+        lock_guard<mutex> lock(m_mutex);
+        m_missCount++;
+        return false;
+    }
+
+    JValue cached = JDomParser::fromString(serialized);
+    if (!cached.isObject()) {
+        lock_guard<mutex> lock(m_mutex);
+        m_missCount++;
+        return false;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(folderPath);
+    if (it != m_entries.end())
+        it->second.isUsed = true;
+    m_hitCount++;
+    appinfo = cached;
+    isLocalized = (flags & FLAG_LOCALIZED) != 0;
+    hasSysAssets = (flags & FLAG_SYS_ASSETS) != 0;
+    return true;
+}
+
+bool AppCatalogCache::isValid(const string& folderPath, const AppLocation& appLocation)
+{
+    vector<Signature> signatures;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        checkKey();
+
+        auto it = m_entries.find(folderPath);
+        if (it == m_entries.end() || it->second.appLocation != appLocation)
+            return false;
+        signatures = it->second.signatures;
+    }
+
+    if (!isUnchanged(signatures))
+        return false;
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(folderPath);
+    if (it != m_entries.end())
+        it->second.isUsed = true;
+    return true;
+}
+
+void AppCatalogCache::store(const string& folderPath, const AppLocation& appLocation, const JValue& appinfo, bool isLocalized, bool hasSysAssets)
+{
+    Entry entry;
+    entry.appLocation = appLocation;
+    entry.flags = (isLocalized ? FLAG_LOCALIZED : 0) | (hasSysAssets ? FLAG_SYS_ASSETS : 0);
+    entry.appinfo = NULL;
+    entry.appinfoLength = 0;
+    entry.stored = appinfo.stringify();
+    entry.isUsed = true;
+    makeSignatures(folderPath, appinfo, entry.signatures);
+
+    lock_guard<mutex> lock(m_mutex);
+    checkKey();
+    m_entries[folderPath] = std::move(entry);
+    m_isDirty = true;
+}
+
+void AppCatalogCache::prune()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.isUsed) {
+            ++it;
+            continue;
+        }
+        it = m_entries.erase(it);
+        m_isDirty = true;
+    }
+    Logger::info(getClassName(), __FUNCTION__,
+                 Logger::format("entries(%d) hit(%d) miss(%d)", (int) m_entries.size(), m_hitCount, m_missCount));
+}
+
+bool AppCatalogCache::save()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_isDirty || m_path.empty())
+        return true;
+
+    string buffer;
+    buffer.append(MAGIC, strlen(MAGIC));
+    append(buffer, VERSION);
+    append(buffer, m_localeKey);
+    append(buffer, m_fallbackKey);
+    append(buffer, (uint32_t) m_entries.size());
+    for (const auto& it : m_entries) {
+        const Entry& entry = it.second;
+        append(buffer, it.first);
+        append(buffer, (uint8_t) entry.appLocation);
+        append(buffer, entry.flags);
+        append(buffer, (uint32_t) entry.signatures.size());
+        for (const auto& signature : entry.signatures) {
+            append(buffer, signature.path);
+            append(buffer, signature.ino);
+            append(buffer, signature.size);
+            append(buffer, signature.mtimeSec);
+            append(buffer, signature.mtimeNsec);
+        }
+        if (entry.appinfo)
+            append(buffer, entry.appinfo, entry.appinfoLength);
+        else
+            append(buffer, entry.stored);
+    }
+
+    // Current mapping is still valid after rename
+    string tmpPath = m_path + ".tmp";
+    if (!File::writeFile(tmpPath, buffer) || rename(tmpPath.c_str(), m_path.c_str()) != 0) {
+        Logger::warning(getClassName(), __FUNCTION__, m_path, "Failed to save cache");
+        File::deleteFile(tmpPath);
+        return false;
+    }
+    m_isDirty = false;
+    return true;
+}
+
+bool AppCatalogCache::load()
+{
+    int fd = open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    m_mappedLength = (size_t) st.st_size;
+    m_mapped = mmap(NULL, m_mappedLength, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m_mapped == MAP_FAILED) {
+        m_mapped = NULL;
+        m_mappedLength = 0;
+        return false;
+    }
+
+    Reader reader(static_cast<const char*>(m_mapped), m_mappedLength);
+    char magic[8];
+    uint32_t version = 0;
+    string localeKey;
+    string fallbackKey;
+    uint8_t droppedFlags = 0;
+    uint32_t count = 0;
+
+    if (!reader.read(magic) || memcmp(magic, MAGIC, sizeof(magic)) != 0 ||
+        !reader.read(version) || version != VERSION) {
+        Logger::info(getClassName(), __FUNCTION__, "Unsupported cache version");
+        return false;
+    }
+    if (!reader.read(localeKey) || !reader.read(fallbackKey) || !reader.read(count))
+        return false;
+
+    // Only affected entries are dropped
+    if (localeKey != m_localeKey)
+        droppedFlags |= FLAG_LOCALIZED;
+    if (fallbackKey != m_fallbackKey)
+        droppedFlags |= FLAG_SYS_ASSETS;
+    if (droppedFlags != 0) {
+        Logger::info(getClassName(), __FUNCTION__, "Locale or sysAssetFallbackPrecedence is changed");
+        m_isDirty = true;
+    }
+
+    for (uint32_t i = 0; i < count; ++i) {
+        string folderPath;
+        uint8_t appLocation = 0;
+        uint32_t signatureCount = 0;
+        Entry entry;
+
+        if (!reader.read(folderPath) || !reader.read(appLocation) ||
+            !reader.read(entry.flags) || !reader.read(signatureCount))
+            goto Error;
+
+        entry.appLocation = (AppLocation) appLocation;
+        entry.isUsed = false;
+        entry.signatures.resize(signatureCount);
+        for (auto& signature : entry.signatures) {
+            if (!reader.read(signature.path) || !reader.read(signature.ino) || !reader.read(signature.size) ||
+                !reader.read(signature.mtimeSec) || !reader.read(signature.mtimeNsec))
+                goto Error;
+        }
+        if (!reader.read(entry.appinfo, entry.appinfoLength))
+            goto Error;
+
+        if ((entry.flags & droppedFlags) != 0)
+            continue;
+        m_entries[folderPath] = std::move(entry);
+    }
+    return true;
+
+Error:
+    Logger::warning(getClassName(), __FUNCTION__, m_path, "Cache is corrupted");
+    m_entries.clear();
+    return false;
+}
+
+void AppCatalogCache::unload()
+{
+    m_entries.clear();
+    if (m_mapped) {
+        munmap(m_mapped, m_mappedLength);
+        m_mapped = NULL;
+        m_mappedLength = 0;
+    }
+}
+
+string AppCatalogCache::makeLocaleKey()
+{
+    return SAMConf::getInstance().getLanguage() + "/" +
+           SAMConf::getInstance().getScript() + "/" +
+           SAMConf::getInstance().getRegion();
+}
+
+string AppCatalogCache::makeFallbackKey()
+{
+    string key = "";
+    for (const auto& fallback : SAMConf::getInstance().getSysAssetFallbackPrecedence()) {
+        key += fallback + ",";
+    }
+    return key;
+}
+
+void AppCatalogCache::makeSignatures(const string& folderPath, const JValue& appinfo, vector<Signature>& signatures)
+{
+    // Files which are used in AppDescription::loadAppinfo
+    vector<string> paths;
+    paths.push_back(File::join(folderPath, "/appinfo.json"));
+
+    paths.push_back(File::join(folderPath, "/resources"));
+    string resourcePath = folderPath + "/resources/" + SAMConf::getInstance().getLanguage() + "/";
+    paths.push_back(resourcePath + "appinfo.json");
+    resourcePath += SAMConf::getInstance().getScript() + "/";
+    paths.push_back(resourcePath + "appinfo.json");
+    resourcePath += SAMConf::getInstance().getRegion() + "/";
+    paths.push_back(resourcePath + "appinfo.json");
+
+    // Directories which are used in AppDescription::readAsset
+    string sysAssetsBasePath = "sys-assets";
+    JValueUtil::getValue(appinfo, "sysAssetsBasePath", sysAssetsBasePath);
+    const vector<string>& fallbacks = SAMConf::getInstance().getSysAssetFallbackPrecedence();
+    set<string> assetDirs;
+    for (const auto& key : AppDescription::ASSETS_SUPPORTED) {
+        string value;
+        if (!JValueUtil::getValue(appinfo, key, value) || value.compare(0, sysAssetsBasePath.length(), sysAssetsBasePath) != 0)
+            continue;
+
+        string filename = value.substr(sysAssetsBasePath.length());
+        for (const auto& fallback : fallbacks) {
+            string prefix = "/" + fallback + "/";
+            if (filename.compare(0, prefix.length(), prefix) == 0) {
+                filename = filename.substr(prefix.length() - 1);
+                break;
+            }
+        }
+        for (const auto& fallback : fallbacks) {
+            string assetPath = folderPath + "/" + File::join(File::join(sysAssetsBasePath, fallback), filename);
+            assetDirs.insert(assetPath.substr(0, assetPath.find_last_of('/')));
+        }
+    }
+    paths.insert(paths.end(), assetDirs.begin(), assetDirs.end());
+
+    signatures.resize(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        makeSignature(paths[i], signatures[i]);
+    }
+}
+
+void AppCatalogCache::checkKey()
+{
+    string localeKey = makeLocaleKey();
+    if (localeKey != m_localeKey) {
+        Logger::info(getClassName(), __FUNCTION__, "Locale is changed");
+        m_localeKey = localeKey;
+        dropEntries(FLAG_LOCALIZED);
+    }
+
+    string fallbackKey = makeFallbackKey();
+    if (fallbackKey != m_fallbackKey) {
+        Logger::info(getClassName(), __FUNCTION__, "sysAssetFallbackPrecedence is changed");
+        m_fallbackKey = fallbackKey;
+        dropEntries(FLAG_SYS_ASSETS);
+    }
+}
+
+void AppCatalogCache::dropEntries(uint8_t flag)
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if ((it->second.flags & flag) == 0) {
+            ++it;
+            continue;
+        }
+        it = m_entries.erase(it);
+    }
+    m_isDirty = true;
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BASE_APPCATALOGCACHE_H_
+#define BASE_APPCATALOGCACHE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <pbnjson.hpp>
+
+#include "base/AppDescription.h"
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+using namespace pbnjson;
+
+// AppCatalogCache keeps the result of AppDescription scanning on disk.
+// Each entry is keyed by folder path and is valid only when every file
+// which was used to build it (appinfo.json, localization overlays and
+// sys-assets directories) has same inode, size and mtime.
+// Entries of localized apps are dropped if locale is changed and entries of
+// apps using sys-assets are dropped if sysAssetFallbackPrecedence is changed.
+class AppCatalogCache : public ISingleton<AppCatalogCache>,
+                        public IClassName {
+friend class ISingleton<AppCatalogCache>;
+public:
+    virtual ~AppCatalogCache();
+
+    void initialize();
+
+    // Following two can be called by scanning workers
+    bool lookup(const string& folderPath, const AppLocation& appLocation, JValue& appinfo, bool& isLocalized, bool& hasSysAssets);
+    void store(const string& folderPath, const AppLocation& appLocation, const JValue& appinfo, bool isLocalized, bool hasSysAssets);
+
+    // true if files of the entry are not changed. appinfo is not parsed
+    bool isValid(const string& folderPath, const AppLocation& appLocation);
+
+    void prune();
+    bool save();
+
+private:
+    static const char* MAGIC;
+    static const uint32_t VERSION;
+    static const uint8_t FLAG_LOCALIZED = 0x01;
+    static const uint8_t FLAG_SYS_ASSETS = 0x02;
+
+    struct Signature {
+        string path;
+        uint64_t ino;
+        int64_t size;
+        int64_t mtimeSec;
+        int64_t mtimeNsec;
+
+        bool operator==(const Signature& other) const
+        {
+            return ino == other.ino && size == other.size &&
+                   mtimeSec == other.mtimeSec && mtimeNsec == other.mtimeNsec;
+        }
+    };
+
+    struct Entry {
+        AppLocation appLocation;
+        uint8_t flags;
+        vector<Signature> signatures;
+        // points mmapped file or 'stored' string
+        const char* appinfo;
+        size_t appinfoLength;
+        string stored;
+        bool isUsed;
+    };
+
+    static void makeSignature(const string& path, Signature& signature);
+    static bool isUnchanged(const vector<Signature>& signatures);
+
+    AppCatalogCache();
+
+    bool load();
+    void unload();
+    string makeLocaleKey();
+    string makeFallbackKey();
+    void makeSignatures(const string& folderPath, const JValue& appinfo, vector<Signature>& signatures);
+    void checkKey();
+    void dropEntries(uint8_t flag);
+
+    string m_path;
+    string m_localeKey;
+    string m_fallbackKey;
+
+    void* m_mapped;
+    size_t m_mappedLength;
+
+    map<string, Entry> m_entries;
+    mutex m_mutex;
+    bool m_isDirty;
+
+    int m_hitCount;
+    int m_missCount;
+};
+
+#endif /* BASE_APPCATALOGCACHE_H_ */
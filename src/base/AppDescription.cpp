@@ -14,6 +14,7 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include <dirent.h>
 #include <glib.h>
 #include <stdio.h>
 #include <sys/stat.h>
@@ -23,6 +24,7 @@
 #include <boost/lexical_cast.hpp>
 
 #include "base/AppDescription.h"
+#include "base/AppCatalogCache.h"
 #include "bus/client/SettingService.h"
 #include "conf/SAMConf.h"
 #include "util/JValueUtil.h"
@@ -168,10 +170,14 @@ AppDescription::AppDescription(const string& appId)
     : m_appLocation(AppLocation::AppLocation_None),
       m_folderPath(""),
       m_appId(appId),
+      m_appSymbol(SymbolTable::getInstance().intern(appId)),
       m_appType(AppType::AppType_None),
       m_intVersion(1, 0, 0),
       m_absMain(""),
       m_absSplashBackground(""),
+      m_isLocalized(false),
+      m_hasSysAssets(false),
+      m_revision(0),
       m_isLocked(false),
       m_isScanned(false)
 {
@@ -184,26 +190,31 @@ AppDescription::~AppDescription()
 bool AppDescription::scan()
 {
     m_isScanned = false;
+    onChanged();
     if (m_appId.empty() || m_folderPath.empty() || m_appLocation == AppLocation::AppLocation_None) {
         Logger::warning(CLASS_NAME, __FUNCTION__, m_appId, "Required members are not set");
         return false;
     }
 
-    if (!File::isDirectory(m_folderPath)) {
-        Logger::warning(CLASS_NAME, __FUNCTION__, m_appId, "FolderPath is not exist");
-        return false;
-    }
-
     if (!isAllowedAppId()) {
         Logger::warning(CLASS_NAME, __FUNCTION__, m_appId, "AppId is not allowed");
         return false;
     }
 
+    if (AppCatalogCache::getInstance().lookup(m_folderPath, m_appLocation, m_appinfo, m_isLocalized, m_hasSysAssets) && readAppinfo()) {
+        // base appinfo and sys-assets will be loaded from disk if they are needed
+        m_baseAppinfo = pbnjson::JValue();
+        m_sysAssets.clear();
+        m_isScanned = true;
+        return true;
+    }
+
     if (!loadAppinfo() || !readAppinfo() || !readAsset()) {
         Logger::warning(CLASS_NAME, __FUNCTION__, m_appId, "Cannot configure AppDescription");
         return false;
     }
 
+    AppCatalogCache::getInstance().store(m_folderPath, m_appLocation, m_appinfo, m_isLocalized, m_hasSysAssets);
     m_isScanned = true;
     return true;
 }
@@ -217,6 +228,41 @@ bool AppDescription::scan(const string& folderPath, const AppLocation& appLocati
     return scan();
 }
 
+bool AppDescription::changeSysAssetFallbackPrecedence()
+{
+    if (!m_isScanned || !m_hasSysAssets)
+        return false;
+
+    // '$' values are not in memory if it is restored from AppCatalogCache
+    if (m_sysAssets.empty())
+        return scan();
+
+    resolveSysAssets();
+    onChanged();
+    AppCatalogCache::getInstance().store(m_folderPath, m_appLocation, m_appinfo, m_isLocalized, m_hasSysAssets);
+    return true;
+}
+
+bool AppDescription::changeLocale()
+{
+    if (!m_isScanned || !m_isLocalized)
+        return false;
+
+    // base appinfo is not in memory if it is restored from AppCatalogCache
+    if (m_baseAppinfo.isNull())
+        return scan();
+
+    m_appinfo = m_baseAppinfo.duplicate();
+    applyLocalization();
+    onChanged();
+    if (!readAppinfo() || !readAsset()) {
+        Logger::warning(CLASS_NAME, __FUNCTION__, m_appId, "Cannot configure AppDescription");
+        return false;
+    }
+    AppCatalogCache::getInstance().store(m_folderPath, m_appLocation, m_appinfo, m_isLocalized, m_hasSysAssets);
+    return true;
+}
+
 void AppDescription::applyFolderPath(string& path)
 {
     if (path.compare(0, 7, "file://") == 0)
@@ -280,6 +326,19 @@ bool AppDescription::loadAppinfo()
     /// Add folderPath to JSON
     m_appinfo.put("folderPath", m_folderPath);
 
+    // Most of apps don't have localization. Don't need to keep base appinfo for them
+    m_isLocalized = File::isDirectory(File::join(m_folderPath, "/resources"));
+    if (!m_isLocalized) {
+        m_baseAppinfo = pbnjson::JValue();
+        return true;
+    }
+    m_baseAppinfo = m_appinfo.duplicate();
+    applyLocalization();
+    return true;
+}
+
+void AppDescription::applyLocalization()
+{
     vector<string> localizationDirs;
     string resourcePath = m_folderPath + "/resources/" + SAMConf::getInstance().getLanguage() + "/";
     localizationDirs.push_back(resourcePath);
@@ -342,7 +401,6 @@ bool AppDescription::loadAppinfo()
             }
         }
     }
-    return true;
 }
 
 bool AppDescription::readAppinfo()
@@ -388,6 +446,7 @@ bool AppDescription::readAppinfo()
     if (AppLocation::AppLocation_Devmode == m_appLocation) {
         m_appinfo.put("inspectable", true);
     }
+    decodeFields();
     return true;
 }
 
@@ -396,9 +455,9 @@ bool AppDescription::readAsset()
     string sysAssetsBasePath = "sys-assets";
     JValueUtil::getValue(m_appinfo, "sysAssetsBasePath", sysAssetsBasePath);
 
+    m_sysAssets.clear();
     for (const auto& key : ASSETS_SUPPORTED) {
         string value;
-        string variant_path;
 
         if (!JValueUtil::getValue(m_appinfo, key, value) || value.empty()) {
             continue;
@@ -408,33 +467,116 @@ bool AppDescription::readAsset()
         if (value.length() < 2 || value[0] != '$') {
             continue;
         }
+        m_sysAssets[key] = value.substr(1);
+    }
+    m_hasSysAssets = !m_sysAssets.empty();
+    if (!m_hasSysAssets) {
+        return true;
+    }
 
-        string filename = value.substr(1);
-        bool foundAsset = false;
-
-        JValue fallbacks = SAMConf::getInstance().getSysAssetFallbackPrecedence();
-        for (int i = 0; i < fallbacks.arraySize(); i++) {
-            string assetPath = File::join(File::join(sysAssetsBasePath, fallbacks[i].asString()), filename);
-            string pathToCheck = "";
+    // Directory listing is reused until sys-assets directories are modified
+    if (m_sysAssetsBasePath != sysAssetsBasePath || !isSysAssetsIndexValid()) {
+        indexSysAssets(sysAssetsBasePath);
+    }
+    resolveSysAssets();
+    return true;
+}
 
-            // set asset without variant
-            pathToCheck = m_folderPath + string("/") + assetPath;
-            Logger::debug(CLASS_NAME, __FUNCTION__, Logger::format("patch_to_check: %s\n", pathToCheck.c_str()));
+bool AppDescription::isSysAssetsIndexValid()
+{
+    if (m_sysAssetsDirs.empty())
+        return false;
 
-            if (0 == access(pathToCheck.c_str(), F_OK)) {
-                m_appinfo.put(key, assetPath);
-                foundAsset = true;
-                break;
-            }
+    struct stat st;
+    for (const auto& dir : m_sysAssetsDirs) {
+        if (stat(dir.first.c_str(), &st) != 0) {
+            if (dir.second != -1)
+                return false;
+            continue;
         }
+        if ((int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec != dir.second)
+            return false;
+    }
+    return true;
+}
+
+void AppDescription::indexSysAssets(const string& sysAssetsBasePath)
+{
+    m_sysAssetsBasePath = sysAssetsBasePath;
+    m_sysAssetsIndex.clear();
+    m_sysAssetsDirs.clear();
+    indexSysAssets(File::join(m_folderPath, sysAssetsBasePath), "", 0);
+    Logger::debug(CLASS_NAME, __FUNCTION__, m_appId,
+                  Logger::format("files(%d) dirs(%d)", (int) m_sysAssetsIndex.size(), (int) m_sysAssetsDirs.size()));
+}
+
+void AppDescription::indexSysAssets(const string& path, const string& relativePath, int depth)
+{
+    static const int MAX_DEPTH = 8;
+
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+        // not existing directory is also indexed. It will be created later
+        m_sysAssetsDirs[path] = -1;
+        return;
+    }
+    m_sysAssetsDirs[path] = (int64_t) st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+
+    DIR* dir = opendir(path.c_str());
+    if (dir == NULL)
+        return;
 
-        if (foundAsset) {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
             continue;
-        }
 
-        string defaultAsset = File::join(sysAssetsBasePath, filename);
-        m_appinfo.put(key, defaultAsset);
+        string relativeName = relativePath.empty() ? entry->d_name : relativePath + "/" + entry->d_name;
+        m_sysAssetsIndex.insert(relativeName);
+
+        bool isDirectory = (entry->d_type == DT_DIR);
+        if (entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK)
+            isDirectory = File::isDirectory(File::join(path, entry->d_name));
+        if (isDirectory && depth < MAX_DEPTH)
+            indexSysAssets(File::join(path, entry->d_name), relativeName, depth + 1);
     }
-    return true;
+    closedir(dir);
+}
+
+void AppDescription::resolveSysAssets()
+{
+    for (const auto& asset : m_sysAssets) {
+        string filename = asset.second;
+        while (!filename.empty() && filename[0] == '/')
+            filename.erase(0, 1);
+
+        string assetPath = File::join(m_sysAssetsBasePath, asset.second);
+        for (const auto& fallback : SAMConf::getInstance().getSysAssetFallbackPrecedence()) {
+            if (m_sysAssetsIndex.find(fallback + "/" + filename) != m_sysAssetsIndex.end()) {
+                assetPath = File::join(File::join(m_sysAssetsBasePath, fallback), asset.second);
+                break;
+            }
+        }
+        m_appinfo.put(asset.first, assetPath);
+    }
+    decodeFields();
 }
 
+void AppDescription::decodeFields()
+{
+    Fields fields;
+    JValueUtil::getValue(m_appinfo, "title", fields.title);
+    JValueUtil::getValue(m_appinfo, "icon", fields.icon);
+    JValueUtil::getValue(m_appinfo, "largeIcon", fields.largeIcon);
+    JValueUtil::getValue(m_appinfo, "bgImage", fields.bgImage);
+    JValueUtil::getValue(m_appinfo, "bgColor", fields.bgColor);
+    JValueUtil::getValue(m_appinfo, "defaultWindowType", fields.defaultWindowType);
+    JValueUtil::getValue(m_appinfo, "requiredMemory", fields.requiredMemory);
+    JValueUtil::getValue(m_appinfo, "nativeLifeCycleInterfaceVersion", fields.nativeLifeCycleInterfaceVersion);
+    JValueUtil::getValue(m_appinfo, "noSplashOnLaunch", fields.noSplashOnLaunch);
+    JValueUtil::getValue(m_appinfo, "removable", fields.removable);
+    JValueUtil::getValue(m_appinfo, "spinnerOnLaunch", fields.spinnerOnLaunch);
+    JValueUtil::getValue(m_appinfo, "unmovable", fields.unmovable);
+    JValueUtil::getValue(m_appinfo, "visible", fields.visible);
+    m_fields = std::move(fields);
+}
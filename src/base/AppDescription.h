@@ -18,9 +18,11 @@
 #define BASE_APPDESCRIPTION_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <pbnjson.hpp>
 #include <stdint.h>
+#include <set>
 #include <string>
 #include <tuple>
 
@@ -28,6 +30,7 @@
 #include "interface/IClassName.h"
 #include "util/JValueUtil.h"
 #include "util/Logger.h"
+#include "util/SymbolTable.h"
 
 const unsigned int APP_VERSION_DIGIT = 3;
 
@@ -64,6 +67,7 @@ typedef shared_ptr<AppDescription> AppDescriptionPtr;
 typedef tuple<uint16_t, uint16_t, uint16_t> AppIntVersion;
 
 class AppDescription {
+friend class AppCatalogCache;
 friend class AppDescriptionList;
 public:
     static string toString(const AppStatusEvent& event);
@@ -79,6 +83,8 @@ public:
 
     bool scan();
     bool scan(const string& folderPath, const AppLocation& appLocation);
+    bool changeLocale();
+    bool changeSysAssetFallbackPrecedence();
     void applyFolderPath(string& path);
 
     bool isLocked() const
@@ -106,6 +112,20 @@ public:
         json = m_appinfo.duplicate();
     }
 
+    // serialized appinfo. It is reused until appinfo is changed
+    const string& getSnapshot()
+    {
+        if (m_snapshot.empty())
+            m_snapshot = m_appinfo.stringify();
+        return m_snapshot;
+    }
+
+    // increased whenever appinfo is changed
+    unsigned int getRevision() const
+    {
+        return m_revision;
+    }
+
     const string& getFolderPath() const
     {
         return m_folderPath;
@@ -130,6 +150,11 @@ public:
         return m_appId;
     }
 
+    Symbol getAppSymbol() const
+    {
+        return m_appSymbol;
+    }
+
     const string& getAbsMain() const
     {
         return m_absMain;
@@ -140,32 +165,24 @@ public:
         return m_appType;
     }
 
-    const string getBgColor() const
+    const string& getBgColor() const
     {
-        string bgColor = "";
-        JValueUtil::getValue(m_appinfo, "bgColor", bgColor);
-        return bgColor;
+        return m_fields.bgColor;
     }
 
-    const string getBgImage() const
+    const string& getBgImage() const
     {
-        string bgImage = "";
-        JValueUtil::getValue(m_appinfo, "bgImage", bgImage);
-        return bgImage;
+        return m_fields.bgImage;
     }
 
-    const string getDefaultWindowType() const
+    const string& getDefaultWindowType() const
     {
-        string defaultWindowType = "";
-        JValueUtil::getValue(m_appinfo, "defaultWindowType", defaultWindowType);
-        return defaultWindowType;
+        return m_fields.defaultWindowType;
     }
 
-    const string getIcon() const
+    const string& getIcon() const
     {
-        string icon = "";
-        JValueUtil::getValue(m_appinfo, "icon", icon);
-        return icon;
+        return m_fields.icon;
     }
 
     const AppIntVersion& getIntVersion() const
@@ -173,25 +190,19 @@ public:
         return m_intVersion;
     }
 
-    const string getLargeIcon() const
+    const string& getLargeIcon() const
     {
-        string largeIcon = "";
-        JValueUtil::getValue(m_appinfo, "largeIcon", largeIcon);
-        return largeIcon;
+        return m_fields.largeIcon;
     }
 
     int getNativeInterfaceVersion() const
     {
-        int nativeLifeCycleInterfaceVersion = 1;
-        JValueUtil::getValue(m_appinfo, "nativeLifeCycleInterfaceVersion", nativeLifeCycleInterfaceVersion);
-        return nativeLifeCycleInterfaceVersion;
+        return m_fields.nativeLifeCycleInterfaceVersion;
     }
 
     int getRequiredMemory() const
     {
-        int requiredMemory = 0;
-        JValueUtil::getValue(m_appinfo, "requiredMemory", requiredMemory);
-        return requiredMemory;
+        return m_fields.requiredMemory;
     }
 
     const string& getSplashBackground() const
@@ -199,11 +210,9 @@ public:
         return m_absSplashBackground;
     }
 
-    const string getTitle() const
+    const string& getTitle() const
     {
-        string title = "";
-        JValueUtil::getValue(m_appinfo, "title", title);
-        return title;
+        return m_fields.title;
     }
 
     bool isAllowedAppId()
@@ -224,9 +233,7 @@ public:
 
     bool isNoSplashOnLaunch() const
     {
-        bool noSplashOnLaunch = true;
-        JValueUtil::getValue(m_appinfo, "noSplashOnLaunch", noSplashOnLaunch);
-        return noSplashOnLaunch;
+        return m_fields.noSplashOnLaunch;
     }
 
     bool isPrivilegedAppId()
@@ -240,9 +247,7 @@ public:
 
     bool isRemovable() const
     {
-        bool removable = true;
-        JValueUtil::getValue(m_appinfo, "removable", removable);
-        return removable;
+        return m_fields.removable;
     }
 
     bool isScanned() const
@@ -252,9 +257,7 @@ public:
 
     bool isSpinnerOnLaunch() const
     {
-        bool spinnerOnLaunch = false;
-        JValueUtil::getValue(m_appinfo, "spinnerOnLaunch", spinnerOnLaunch);
-        return spinnerOnLaunch;
+        return m_fields.spinnerOnLaunch;
     }
 
     bool isSystemApp() const
@@ -272,19 +275,50 @@ public:
 
     bool isUnmovable() const
     {
-        bool unmovable = false;
-        JValueUtil::getValue(m_appinfo, "unmovable", unmovable);
-        return unmovable;
+        return m_fields.unmovable;
     }
 
     bool isVisible() const
     {
-        bool visible = true;
-        JValueUtil::getValue(m_appinfo, "visible", visible);
-        return visible;
+        return m_fields.visible;
+    }
+
+    // true if the app has 'resources' directory for localization
+    bool isLocalized() const
+    {
+        return m_isLocalized;
     }
 
 private:
+    // Frequently used appinfo fields. Those are decoded whenever appinfo is changed
+    // so getters don't need to look up JValue.
+    struct Fields {
+        Fields()
+            : requiredMemory(0),
+              nativeLifeCycleInterfaceVersion(1),
+              noSplashOnLaunch(true),
+              removable(true),
+              spinnerOnLaunch(false),
+              unmovable(false),
+              visible(true)
+        {
+        }
+
+        string title;
+        string icon;
+        string largeIcon;
+        string bgImage;
+        string bgColor;
+        string defaultWindowType;
+        int requiredMemory;
+        int nativeLifeCycleInterfaceVersion;
+        bool noSplashOnLaunch;
+        bool removable;
+        bool spinnerOnLaunch;
+        bool unmovable;
+        bool visible;
+    };
+
     static const vector<string> PROPS_PROHIBITED;
     static const vector<string> PROPS_IMAGES;
     static const vector<string> ASSETS_SUPPORTED;
@@ -294,8 +328,20 @@ private:
     AppDescription(const AppDescription& appDesc) = delete;
 
     bool loadAppinfo();
+    void applyLocalization();
     bool readAppinfo();
     bool readAsset();
+    bool isSysAssetsIndexValid();
+    void indexSysAssets(const string& sysAssetsBasePath);
+    void indexSysAssets(const string& path, const string& relativePath, int depth);
+    void resolveSysAssets();
+    void decodeFields();
+
+    void onChanged()
+    {
+        m_snapshot.clear();
+        m_revision++;
+    }
 
     bool isValidAppInfo(JValue& appinfo)
     {
@@ -328,14 +374,31 @@ private:
     AppLocation m_appLocation;
     string m_folderPath;
     string m_appId;
+    Symbol m_appSymbol;
 
     // from appinfo.json
     AppType m_appType;
     AppIntVersion m_intVersion;
     string m_absMain;
     string m_absSplashBackground;
+    Fields m_fields;
 
     JValue m_appinfo;
+    // appinfo.json before localization. This is kept only for localized apps
+    JValue m_baseAppinfo;
+    bool m_isLocalized;
+
+    // '$' prefixed assets. key => filename
+    map<string, string> m_sysAssets;
+    bool m_hasSysAssets;
+    // files under sysAssetsBasePath and mtime of directories which are listed
+    string m_sysAssetsBasePath;
+    set<string> m_sysAssetsIndex;
+    map<string, int64_t> m_sysAssetsDirs;
+
+    string m_snapshot;
+    unsigned int m_revision;
+
     // runtime values
     bool m_isLocked;
     bool m_isScanned;
@@ -16,10 +16,16 @@
 
 #include "base/AppDescriptionList.h"
 
+#include <unistd.h>
+
+#include "base/AppCatalogCache.h"
 #include "base/LaunchPointList.h"
+#include "base/RecentList.h"
 #include "bus/service/ApplicationManager.h"
 #include "conf/SAMConf.h"
+#include "util/BootTimeline.h"
 #include "util/File.h"
+#include "util/Time.h"
 
 bool AppDescriptionList::compare(AppDescriptionPtr me, AppDescriptionPtr another)
 {
@@ -46,46 +52,151 @@ bool AppDescriptionList::compare(AppDescriptionPtr me, AppDescriptionPtr another
     else if (get<2>(meVersion) > get<2>(anotherVersion))
         return false;
 
-    // if same version, check type_by_dir priority
-    if ((int) me->getAppLocation() > (int) me->getAppLocation())
+    // if same version, check type_by_dir priority. Smaller AppLocation has higher priority
+    if ((int) me->getAppLocation() > (int) another->getAppLocation())
         return true;
 
     return false;
 }
 
+void AppDescriptionList::onScanWorker(gpointer data, gpointer userData)
+{
+    AppDescription* appDesc = static_cast<AppDescription*>(data);
+    long long begin = Time::getCurrentTimeUs();
+    try {
+        appDesc->scan();
+    } catch (...) {
+        // Exception should not go over worker thread
+        Logger::warning(getInstance().getClassName(), __FUNCTION__, appDesc->getAppId(), "Exception is thrown while scanning");
+    }
+    BootTimeline::getInstance().addApp(appDesc->getAppId(), appDesc->getFolderPath(), begin, Time::getCurrentTimeUs());
+}
+
+gboolean AppDescriptionList::onIdleScan(gpointer data)
+{
+    AppDescriptionList* self = static_cast<AppDescriptionList*>(data);
+    vector<AppDescriptionPtr> chunk;
+    while (self->m_remainingIndex < self->m_remaining.size() && chunk.size() < SCAN_CHUNK_SIZE) {
+        chunk.push_back(std::move(self->m_remaining[self->m_remainingIndex++]));
+    }
+    // Chunks are scanned serially. A thread pool per chunk costs more than it saves
+    // and the main loop is blocked by one chunk only
+    for (const auto& appDesc : chunk) {
+        onScanWorker(appDesc.get(), NULL);
+    }
+    self->addScanned(chunk);
+
+    if (self->m_remainingIndex < self->m_remaining.size())
+        return G_SOURCE_CONTINUE;
+
+    self->m_idleScanSource = 0;
+    self->m_remaining.clear();
+    self->m_remainingIndex = 0;
+    BootTimeline::getInstance().end("scanRemaining");
+    self->onFullyScanned();
+    return G_SOURCE_REMOVE;
+}
+
 AppDescriptionList::AppDescriptionList()
+    : m_isSnapshotValid(false),
+      m_remainingIndex(0),
+      m_idleScanSource(0),
+      m_isFullyScanned(false),
+      m_isListingFailed(false)
 {
     setClassName("AppDescriptionList");
 }
 
 AppDescriptionList::~AppDescriptionList()
 {
+    if (m_idleScanSource > 0)
+        g_source_remove(m_idleScanSource);
 }
 
 void AppDescriptionList::changeLocale()
 {
-    for (const auto& appDesc : m_map) {
-        appDesc.second->scan();
+    // Only apps which have 'resources' directory are affected by locale.
+    // Shadowed copies are also localized because they can be listed at any time
+    int count = 0;
+    for (const auto& copies : m_copies) {
+        for (const auto& appDesc : copies.second) {
+            if (appDesc->changeLocale() && isListed(appDesc))
+                count++;
+        }
     }
+    AppCatalogCache::getInstance().save();
+    if (count > 0)
+        m_isSnapshotValid = false;
+
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("localized(%d) total(%d)", count, (int) m_map.size()));
+    if (count > 0)
+        ApplicationManager::getInstance().postListApps(nullptr, "", "localeChanged");
+
+    // collation order depends on locale even if titles are not changed
+    LaunchPointList::getInstance().changeLocale();
+}
+
+void AppDescriptionList::changeSysAssetFallbackPrecedence()
+{
+    // Only apps which have '$' prefixed assets are affected. They are resolved in memory
+    int count = 0;
+    for (const auto& copies : m_copies) {
+        for (const auto& appDesc : copies.second) {
+            if (appDesc->changeSysAssetFallbackPrecedence() && isListed(appDesc))
+                count++;
+        }
+    }
+    AppCatalogCache::getInstance().save();
+    if (count > 0)
+        m_isSnapshotValid = false;
+
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("resolved(%d) total(%d)", count, (int) m_map.size()));
+    if (count > 0)
+        ApplicationManager::getInstance().postListApps(nullptr, "", "sysAssetFallbackPrecedenceChanged");
 }
 
 void AppDescriptionList::scanApp(const string& appId)
 {
-    AppDescriptionPtr newAppDesc = AppDescriptionList::getInstance().create(appId);
-    if (newAppDesc == nullptr) {
-        Logger::warning(getInstance().getClassName(), __FUNCTION__, appId, "Failed to create new AppDescription");
-        return;
+    set<string> appIds;
+    appIds.insert(appId);
+    scanApps(appIds);
+}
+
+void AppDescriptionList::scanApps(const set<string>& appIds)
+{
+    // Each location is opened once and app folders are checked relative to it
+    const vector<ApplicationPath>& applicationPaths = SAMConf::getInstance().getApplicationPaths();
+    vector<int> dirFds(applicationPaths.size(), -1);
+    for (size_t i = 0; i < applicationPaths.size(); ++i) {
+        if (!applicationPaths[i].path.empty())
+            dirFds[i] = File::openDirectory(applicationPaths[i].path);
     }
 
-    JValue applicationPaths = SAMConf::getInstance().getApplicationPaths();
-    for (int i = applicationPaths.arraySize() - 1; i >= 0; i--) {
-        string path = "";
-        string typeByDir = "";
+    for (const auto& appId : appIds) {
+        rescanApp(appId, dirFds);
+    }
 
-        if (!JValueUtil::getValue(applicationPaths[i], "path", path) ||
-            !JValueUtil::getValue(applicationPaths[i], "typeByDir", typeByDir)) {
-            continue;
-        }
+    for (int fd : dirFds) {
+        if (fd >= 0)
+            close(fd);
+    }
+    AppCatalogCache::getInstance().save();
+}
+
+void AppDescriptionList::rescanApp(const string& appId, const vector<int>& dirFds)
+{
+    if (appId.empty()) {
+        Logger::warning(getClassName(), __FUNCTION__, "AppId is empty");
+        return;
+    }
+
+    // Known copies are checked with their file signatures only.
+    // appinfo.json is parsed again only for new or changed copies
+    Symbol appSymbol = SymbolTable::getInstance().find(appId);
+    const vector<ApplicationPath>& applicationPaths = SAMConf::getInstance().getApplicationPaths();
+    for (size_t i = 0; i < applicationPaths.size(); ++i) {
+        const string& path = applicationPaths[i].path;
+        const string& typeByDir = applicationPaths[i].typeByDir;
 
         AppLocation appLocation = AppDescription::toAppLocation(typeByDir);
         if (path.empty() || typeByDir.empty() || appLocation == AppLocation::AppLocation_None) {
@@ -96,39 +207,134 @@ void AppDescriptionList::scanApp(const string& appId)
         }
 
         string folderPath = File::join(path, appId);
-        if (!File::isDirectory(folderPath)) {
-            Logger::warning(getClassName(), __FUNCTION__, appId, folderPath + " is not exist");
+        AppDescriptionPtr copy = findCopy(appSymbol, folderPath);
+        // A missing location has no copies
+        if (dirFds[i] < 0 || !File::isDirectoryAt(dirFds[i], appId)) {
+            Logger::debug(getClassName(), __FUNCTION__, appId, folderPath + " is not exist");
+            if (copy)
+                eraseCopy(appSymbol, folderPath);
+            continue;
+        }
+        if (copy && copy->getAppLocation() == appLocation && AppCatalogCache::getInstance().isValid(folderPath, appLocation)) {
             continue;
         }
 
+        AppDescriptionPtr newAppDesc = create(appId);
         if (newAppDesc->scan(folderPath, appLocation)) {
-            break;
+            appSymbol = newAppDesc->getAppSymbol();
+            putCopy(std::move(newAppDesc));
+        } else {
+            Logger::warning(getClassName(), __FUNCTION__, appId, "Failed to scan " + folderPath);
+            if (copy)
+                eraseCopy(appSymbol, folderPath);
         }
     }
 
-    if (!newAppDesc->isScanned()) {
-        Logger::warning(getClassName(), __FUNCTION__, appId, "Failed to scan AppDescription");
-        AppDescriptionList::getInstance().removeByAppId(appId);
-        return;
-    }
-
-    AppDescriptionList::getInstance().add(std::move(newAppDesc));
+    promote(appId);
 }
 
 void AppDescriptionList::scanFull()
 {
-    JValue applicationPaths = SAMConf::getInstance().getApplicationPaths();
-    for (int i = 0; i < applicationPaths.arraySize(); i++) {
-        string path = "";
-        string typeByDir = "";
+    vector<pair<string, string>> locations;
+    vector<AppDescriptionPtr> candidates;
+
+    BootTimeline::getInstance().begin("scanFull");
+    getLocations(locations);
+    for (const auto& location : locations) {
+        BootTimeline::getInstance().begin("collect:" + location.first);
+        collectDir(location.first, AppDescription::toAppLocation(location.second), candidates);
+        BootTimeline::getInstance().end("collect:" + location.first);
+    }
 
-        if (!JValueUtil::getValue(applicationPaths[i], "path", path) ||
-            !JValueUtil::getValue(applicationPaths[i], "typeByDir", typeByDir)) {
-            Logger::warning(getClassName(), __FUNCTION__,
-                            Logger::format("Invalid Configuration: path(%s) typeByDir(%s)", path.c_str(), typeByDir.c_str()));
+    // appinfo.json parsing is the most expensive part of booting.
+    // Candidates are scanned in parallel and merged in configuration order,
+    // so the result is same with scanning them one by one.
+    BootTimeline::getInstance().begin("scanFull:parse");
+    scanParallel(candidates);
+    BootTimeline::getInstance().end("scanFull:parse");
+    BootTimeline::getInstance().begin("scanFull:merge");
+    addScanned(candidates);
+    BootTimeline::getInstance().end("scanFull:merge");
+    BootTimeline::getInstance().end("scanFull");
+    onFullyScanned();
+    return;
+}
+
+void AppDescriptionList::scanCritical()
+{
+    vector<pair<string, string>> locations;
+    vector<AppDescriptionPtr> candidates;
+    vector<string> keepAliveApps;
+
+    BootTimeline::getInstance().begin("scanCritical");
+    getLocations(locations);
+    SAMConf::getInstance().getKeepAliveApps(keepAliveApps);
+
+    m_remaining.clear();
+    m_remainingIndex = 0;
+    for (const auto& location : locations) {
+        BootTimeline::getInstance().begin("collect:" + location.first);
+        AppLocation appLocation = AppDescription::toAppLocation(location.second);
+        if (SAMConf::getInstance().isCriticalApplicationLocation(location.second)) {
+            collectDir(location.first, appLocation, candidates);
+            BootTimeline::getInstance().end("collect:" + location.first);
             continue;
         }
 
+        // keepAlive apps should be ready before registering service wherever they are
+        for (const auto& appId : keepAliveApps) {
+            collectApp(location.first, appLocation, appId, candidates);
+        }
+
+        vector<AppDescriptionPtr> others;
+        collectDir(location.first, appLocation, others);
+        for (auto& appDesc : others) {
+            if (find(keepAliveApps.begin(), keepAliveApps.end(), appDesc->getAppId()) != keepAliveApps.end())
+                continue;
+            m_remaining.push_back(std::move(appDesc));
+        }
+        BootTimeline::getInstance().end("collect:" + location.first);
+    }
+
+    Logger::info(getClassName(), __FUNCTION__,
+                 Logger::format("critical(%d) remaining(%d)", (int) candidates.size(), (int) m_remaining.size()));
+    BootTimeline::getInstance().begin("scanCritical:parse");
+    scanParallel(candidates);
+    BootTimeline::getInstance().end("scanCritical:parse");
+    BootTimeline::getInstance().begin("scanCritical:merge");
+    addScanned(candidates);
+    BootTimeline::getInstance().end("scanCritical:merge");
+    BootTimeline::getInstance().end("scanCritical");
+}
+
+void AppDescriptionList::scanRemaining()
+{
+    if (m_isFullyScanned || m_idleScanSource > 0)
+        return;
+
+    if (m_remaining.empty()) {
+        onFullyScanned();
+        return;
+    }
+    // APIs should be handled first
+    BootTimeline::getInstance().begin("scanRemaining");
+    m_idleScanSource = g_idle_add(onIdleScan, this);
+}
+
+void AppDescriptionList::scanDir(const string& path, const AppLocation& appLocation)
+{
+    vector<AppDescriptionPtr> candidates;
+    collectDir(path, appLocation, candidates);
+    scanParallel(candidates);
+    addScanned(candidates);
+}
+
+void AppDescriptionList::getLocations(vector<pair<string, string>>& locations)
+{
+    for (const ApplicationPath& applicationPath : SAMConf::getInstance().getApplicationPaths()) {
+        const string& path = applicationPath.path;
+        const string& typeByDir = applicationPath.typeByDir;
+
         AppLocation appLocation = AppDescription::toAppLocation(typeByDir);
         if (path.empty() || typeByDir.empty() || appLocation == AppLocation::AppLocation_None) {
             Logger::warning(getClassName(), __FUNCTION__,
@@ -146,65 +352,110 @@ void AppDescriptionList::scanFull()
                             Logger::format("Directory is not exist: path(%s) typeByDir(%s)", path.c_str(), typeByDir.c_str()));
             continue;
         }
-        scanDir(path, appLocation);
+        locations.push_back(make_pair(path, typeByDir));
     }
-    return;
 }
 
-void AppDescriptionList::scanDir(const string& path, const AppLocation& appLocation)
+void AppDescriptionList::collectDir(const string& path, const AppLocation& appLocation, vector<AppDescriptionPtr>& candidates)
 {
-    dirent** entries = NULL;
-    int entryCount = ::scandir(path.c_str(), &entries, 0, alphasort);
-    if (entries == NULL || entryCount == 0) {
-        Logger::warning(getClassName(), __FUNCTION__, "Failed to call scandir",
+    vector<string> appIds;
+    if (!File::listDirectories(path, appIds)) {
+        Logger::warning(getClassName(), __FUNCTION__, "Failed to list directory",
                         Logger::format("path(%s) appLocation(%s)", path.c_str(), AppDescription::toString(appLocation)));
-        goto Done;
+        m_isListingFailed = true;
+        return;
+    }
+    if (appIds.empty()) {
+        Logger::warning(getClassName(), __FUNCTION__, "Directory is empty",
+                        Logger::format("path(%s) appLocation(%s)", path.c_str(), AppDescription::toString(appLocation)));
+        return;
     }
 
-    for (int i = 0; i < entryCount; ++i) {
-        if (!entries[i] || entries[i]->d_name[0] == '.') {
-            continue;
-        }
-        string folderPath = File::join(path, entries[i]->d_name);
-        if (SAMConf::getInstance().isBlockedApp(entries[i]->d_name)) {
-            Logger::info(getClassName(), __FUNCTION__, "BLOCKED",
-                         Logger::format("forderPath(%s)", folderPath.c_str()));
-            continue;
-        }
-        if (appLocation == AppLocation::AppLocation_System_ReadOnly &&
-            SAMConf::getInstance().isDeletedSystemApp(entries[i]->d_name)) {
-            Logger::info(getClassName(), __FUNCTION__, "DELETED",
-                         Logger::format("forderPath(%s)", folderPath.c_str()));
-            continue;
-        }
-        if (!File::isDirectory(folderPath)) {
-            Logger::warning(getClassName(), __FUNCTION__, entries[i]->d_name, folderPath + " is not exist");
-            continue;
-        }
+    // listDirectories returns only directories. Don't need to check it again
+    for (const auto& appId : appIds) {
+        collectApp(path, appLocation, appId, candidates, false);
+    }
+}
 
-        AppDescriptionPtr appDesc = AppDescriptionList::getInstance().create(entries[i]->d_name);
-        if (!appDesc) {
-            Logger::warning(getClassName(), __FUNCTION__, entries[i]->d_name, "Cannot create application description");
-            continue;
-        }
-        if (!appDesc->scan(folderPath, appLocation)) {
-            Logger::warning(getClassName(), __FUNCTION__, entries[i]->d_name, "Cannot scan AppDescription");
-            continue;
-        }
-        AppDescriptionList::getInstance().add(std::move(appDesc));
+void AppDescriptionList::collectApp(const string& path, const AppLocation& appLocation, const string& appId, vector<AppDescriptionPtr>& candidates, bool checkDirectory)
+{
+    string folderPath = File::join(path, appId);
+    if (SAMConf::getInstance().isBlockedApp(appId)) {
+        Logger::info(getClassName(), __FUNCTION__, "BLOCKED",
+                     Logger::format("forderPath(%s)", folderPath.c_str()));
+        return;
+    }
+    if (appLocation == AppLocation::AppLocation_System_ReadOnly &&
+        SAMConf::getInstance().isDeletedSystemApp(appId)) {
+        Logger::info(getClassName(), __FUNCTION__, "DELETED",
+                     Logger::format("forderPath(%s)", folderPath.c_str()));
+        return;
+    }
+    if (checkDirectory && !File::isDirectory(folderPath)) {
+        Logger::debug(getClassName(), __FUNCTION__, appId, folderPath + " is not exist");
+        return;
+    }
 
+    AppDescriptionPtr appDesc = AppDescriptionList::getInstance().create(appId);
+    if (!appDesc) {
+        Logger::warning(getClassName(), __FUNCTION__, appId, "Cannot create application description");
+        return;
     }
+    appDesc->setFolderPath(folderPath);
+    appDesc->setAppLocation(appLocation);
+    candidates.push_back(std::move(appDesc));
+}
 
-Done:
-    if (entries != NULL) {
-        for (int i = 0; i < entryCount; ++i) {
-            if (entries[i])
-                free(entries[i]);
-        }
-        free(entries);
-        entries = NULL;
+void AppDescriptionList::scanParallel(vector<AppDescriptionPtr>& candidates)
+{
+    GThreadPool* pool = NULL;
+    GError* error = NULL;
+    int workerCount = SAMConf::getInstance().getScanWorkerCount();
+    if (workerCount <= 0)
+        workerCount = (int) g_get_num_processors();
+    if (workerCount > (int) candidates.size())
+        workerCount = (int) candidates.size();
+
+    if (workerCount <= 1)
+        goto Serial;
+
+    // Workers should not modify shared schema cache
+    JValueUtil::getSchema("ApplicationDescription");
+
+    pool = g_thread_pool_new(onScanWorker, NULL, workerCount, TRUE, &error);
+    if (pool == NULL) {
+        Logger::warning(getClassName(), __FUNCTION__, "Failed to create thread pool",
+                        error ? error->message : "");
+        if (error)
+            g_error_free(error);
+        goto Serial;
+    }
+
+    Logger::info(getClassName(), __FUNCTION__,
+                 Logger::format("candidates(%d) workers(%d)", (int) candidates.size(), workerCount));
+    for (const auto& appDesc : candidates) {
+        g_thread_pool_push(pool, appDesc.get(), NULL);
     }
+    // wait until all candidates are scanned
+    g_thread_pool_free(pool, FALSE, TRUE);
     return;
+
+Serial:
+    for (const auto& appDesc : candidates) {
+        onScanWorker(appDesc.get(), NULL);
+    }
+}
+
+void AppDescriptionList::addScanned(vector<AppDescriptionPtr>& candidates)
+{
+    for (auto& appDesc : candidates) {
+        if (!appDesc->isScanned()) {
+            Logger::warning(getClassName(), __FUNCTION__, appDesc->getAppId(), "Cannot scan AppDescription");
+            continue;
+        }
+        AppDescriptionList::getInstance().add(std::move(appDesc));
+    }
+    candidates.clear();
 }
 
 AppDescriptionPtr AppDescriptionList::create(const string& appId)
@@ -220,9 +471,10 @@ AppDescriptionPtr AppDescriptionList::create(const string& appId)
 
 AppDescriptionPtr AppDescriptionList::getByAppId(const string& appId)
 {
-    if (m_map.count(appId) == 0)
+    auto it = m_index.find(SymbolTable::getInstance().find(appId));
+    if (it == m_index.end())
         return NULL;
-    return m_map[appId];
+    return it->second;
 }
 
 bool AppDescriptionList::add(AppDescriptionPtr newAppDesc)
@@ -236,59 +488,146 @@ bool AppDescriptionList::add(AppDescriptionPtr newAppDesc)
         return false;
     }
 
-    if (m_map.find(newAppDesc->getAppId()) == m_map.end()) {
-        Logger::info(getClassName(), __FUNCTION__, newAppDesc->getAppId() + " is added");
-        m_map[newAppDesc->getAppId()] = newAppDesc;
+    // copy in same directory means *update*. Other copies are compared with it in 'promote'
+    string appId = newAppDesc->getAppId();
+    putCopy(std::move(newAppDesc));
+    promote(appId);
+    return true;
+}
+
+void AppDescriptionList::promote(const string& appId)
+{
+    Symbol appSymbol = SymbolTable::getInstance().find(appId);
+    auto copies = m_copies.find(appSymbol);
+    if (copies == m_copies.end()) {
+        removeByAppId(appId);
+        return;
+    }
+
+    AppDescriptionPtr newAppDesc = copies->second.front();
+    for (const auto& copy : copies->second) {
+        if (compare(newAppDesc, copy))
+            newAppDesc = copy;
+    }
+
+    auto it = m_index.find(appSymbol);
+    if (it == m_index.end()) {
+        Logger::info(getClassName(), __FUNCTION__, appId + " is added");
+        put(newAppDesc);
+        m_isSnapshotValid = false;
         ApplicationManager::getInstance().postListApps(newAppDesc, "added", "");
         LaunchPointPtr launchPoint = LaunchPointList::getInstance().createDefault(newAppDesc);
         LaunchPointList::getInstance().add(std::move(launchPoint));
-        return true;
+        return;
     }
+    if (it->second == newAppDesc)
+        return;
+
+    AppDescriptionPtr oldAppDesc = it->second;
+    Logger::info(getClassName(), __FUNCTION__, appId,
+                 Logger::format("folderPath(%s=>%s)", oldAppDesc->getFolderPath().c_str(), newAppDesc->getFolderPath().c_str()));
+    put(newAppDesc);
+    m_isSnapshotValid = false;
+    ApplicationManager::getInstance().postListApps(newAppDesc, "updated", "");
+    LaunchPointList::getInstance().update(std::move(oldAppDesc), newAppDesc);
+}
+
+bool AppDescriptionList::isListed(const AppDescriptionPtr& appDesc)
+{
+    auto it = m_index.find(appDesc->getAppSymbol());
+    return it != m_index.end() && it->second == appDesc;
+}
+
+AppDescriptionPtr AppDescriptionList::findCopy(Symbol appSymbol, const string& folderPath)
+{
+    auto copies = m_copies.find(appSymbol);
+    if (copies == m_copies.end())
+        return nullptr;
 
-    if (m_map[newAppDesc->getAppId()]->getFolderPath() == newAppDesc->getFolderPath()) {
-        // same directory means *update*
-        AppDescriptionPtr oldAppDesc = m_map[newAppDesc->getAppId()];
-        m_map[newAppDesc->getAppId()] = newAppDesc;
-        ApplicationManager::getInstance().postListApps(newAppDesc, "updated", "");
-        LaunchPointList::getInstance().update(oldAppDesc, newAppDesc);
-    } else if (compare(m_map[newAppDesc->getAppId()], newAppDesc) || !m_map[newAppDesc->getAppId()]->scan()) {
-        // TODO why second condition is needed?
-        // check version of new app description.
-        AppDescriptionPtr oldAppDesc = m_map[newAppDesc->getAppId()];
-        m_map[newAppDesc->getAppId()] = newAppDesc;
-        ApplicationManager::getInstance().postListApps(newAppDesc, "updated", "");
-        LaunchPointList::getInstance().update(std::move(oldAppDesc), newAppDesc);
+    for (const auto& copy : copies->second) {
+        if (copy->getFolderPath() == folderPath)
+            return copy;
     }
-    return true;
+    return nullptr;
 }
 
-void AppDescriptionList::removeByAppId(const string& appId)
+void AppDescriptionList::putCopy(AppDescriptionPtr appDesc)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getAppId() == appId) {
-            onRemove((*it).second);
-            m_map.erase(it);
+    // copies are kept in configuration order regardless of how they are found.
+    // First one wins if versions and locations are same
+    vector<AppDescriptionPtr>& copies = m_copies[appDesc->getAppSymbol()];
+    size_t order = getPathOrder(appDesc);
+    auto it = copies.begin();
+    for (; it != copies.end(); ++it) {
+        if ((*it)->getFolderPath() == appDesc->getFolderPath()) {
+            *it = std::move(appDesc);
             return;
         }
+        if (getPathOrder(*it) > order)
+            break;
     }
+    copies.insert(it, std::move(appDesc));
 }
 
-void AppDescriptionList::removeByObject(AppDescriptionPtr appDesc)
+size_t AppDescriptionList::getPathOrder(const AppDescriptionPtr& appDesc)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second == appDesc) {
-            onRemove((*it).second);
-            m_map.erase(it);
-            return;
+    const vector<ApplicationPath>& applicationPaths = SAMConf::getInstance().getApplicationPaths();
+    for (size_t i = 0; i < applicationPaths.size(); ++i) {
+        if (File::join(applicationPaths[i].path, appDesc->getAppId()) == appDesc->getFolderPath())
+            return i;
+    }
+    return applicationPaths.size();
+}
+
+void AppDescriptionList::eraseCopy(Symbol appSymbol, const string& folderPath)
+{
+    auto copies = m_copies.find(appSymbol);
+    if (copies == m_copies.end())
+        return;
+
+    for (auto it = copies->second.begin(); it != copies->second.end(); ++it) {
+        if ((*it)->getFolderPath() == folderPath) {
+            copies->second.erase(it);
+            break;
         }
     }
+    if (copies->second.empty())
+        m_copies.erase(copies);
+}
+
+void AppDescriptionList::removeByAppId(const string& appId)
+{
+    auto it = m_index.find(SymbolTable::getInstance().find(appId));
+    if (it == m_index.end())
+        return;
+
+    AppDescriptionPtr appDesc = it->second;
+    m_copies.erase(appDesc->getAppSymbol());
+    onRemove(appDesc);
+    m_index.erase(it);
+    m_map.erase(appDesc->getAppId());
+}
+
+void AppDescriptionList::removeByObject(AppDescriptionPtr appDesc)
+{
+    if (appDesc == nullptr)
+        return;
+
+    // next copy is listed without scanning. Shadowed copy is just forgotten
+    eraseCopy(appDesc->getAppSymbol(), appDesc->getFolderPath());
+    if (isListed(appDesc))
+        promote(appDesc->getAppId());
 }
 
 bool AppDescriptionList::isExist(const string& appId)
 {
-    if (m_map.count(appId) == 0)
-        return false;
-    return true;
+    return m_index.find(SymbolTable::getInstance().find(appId)) != m_index.end();
+}
+
+void AppDescriptionList::put(AppDescriptionPtr appDesc)
+{
+    m_index[appDesc->getAppSymbol()] = appDesc;
+    m_map[appDesc->getAppId()] = std::move(appDesc);
 }
 
 void AppDescriptionList::toJson(JValue& json, JValue& properties, bool devmode)
@@ -308,6 +647,57 @@ void AppDescriptionList::toJson(JValue& json, JValue& properties, bool devmode)
     }
 }
 
+shared_ptr<const string> AppDescriptionList::getSharedSnapshot(bool devmode)
+{
+    if (m_isSnapshotValid)
+        return devmode ? m_devmodeSnapshot : m_snapshot;
+
+    // each app is serialized only once. Only concatenation is needed here
+    string snapshot = "[";
+    string devmodeSnapshot = "[";
+    for (const auto& appDesc : m_map) {
+        const string& item = appDesc.second->getSnapshot();
+        if (snapshot.size() > 1)
+            snapshot += ",";
+        snapshot += item;
+
+        if (appDesc.second->getAppLocation() != AppLocation::AppLocation_Devmode)
+            continue;
+        if (devmodeSnapshot.size() > 1)
+            devmodeSnapshot += ",";
+        devmodeSnapshot += item;
+    }
+    snapshot += "]";
+    devmodeSnapshot += "]";
+    // Buffers are replaced instead of being modified. Catalog can keep sharing previous ones
+    m_snapshot = make_shared<const string>(std::move(snapshot));
+    m_devmodeSnapshot = make_shared<const string>(std::move(devmodeSnapshot));
+    m_isSnapshotValid = true;
+    return devmode ? m_devmodeSnapshot : m_snapshot;
+}
+
+void AppDescriptionList::syncDeltaLog(DeltaLog& deltaLog)
+{
+    deltaLog.beginSync();
+    for (const auto& appDesc : m_map) {
+        deltaLog.put(appDesc.first, appDesc.second->getJson(), appDesc.second->getSnapshot(), appDesc.second->isDevmodeApp());
+    }
+    deltaLog.endSync();
+}
+
+void AppDescriptionList::onFullyScanned()
+{
+    // entries of removed folders are not needed anymore
+    if (!m_isListingFailed)
+        AppCatalogCache::getInstance().prune();
+    AppCatalogCache::getInstance().save();
+
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("apps(%d)", (int) m_map.size()));
+    m_isFullyScanned = true;
+    BootTimeline::getInstance().mark("fullyScanned");
+    EventFullyScanned();
+}
+
 void AppDescriptionList::onRemove(AppDescriptionPtr appDesc)
 {
     if (appDesc->isSystemApp()) {
@@ -315,6 +705,8 @@ void AppDescriptionList::onRemove(AppDescriptionPtr appDesc)
         SAMConf::getInstance().appendDeletedSystemApp(appDesc->getAppId());
     }
     LaunchPointList::getInstance().removeByAppDesc(appDesc);
+    RecentList::getInstance().removeByAppId(appDesc->getAppId());
     Logger::info(getClassName(), __FUNCTION__, appDesc->getAppId());
+    m_isSnapshotValid = false;
     ApplicationManager::getInstance().postListApps(std::move(appDesc), "removed", "");
 }
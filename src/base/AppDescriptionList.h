@@ -20,10 +20,16 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+#include <glib.h>
+#include <boost/signals2.hpp>
 
 #include "AppDescription.h"
 #include "interface/IClassName.h"
 #include "interface/ISingleton.h"
+#include "util/DeltaLog.h"
 
 using namespace std;
 
@@ -36,11 +42,23 @@ public:
     virtual ~AppDescriptionList();
 
     void changeLocale();
+    void changeSysAssetFallbackPrecedence();
 
     void scanApp(const string& appId);
+    // same as scanApp but the catalog cache is saved only once for all apps
+    void scanApps(const set<string>& appIds);
     void scanFull();
     void scanDir(const string& path, const AppLocation& appLocation);
 
+    // Staged scanning. Critical apps are scanned synchronously and others are scanned in idle time
+    void scanCritical();
+    void scanRemaining();
+
+    bool isFullyScanned() const
+    {
+        return m_isFullyScanned;
+    }
+
     AppDescriptionPtr create(const string& appId);
     AppDescriptionPtr getByAppId(const string& appId);
 
@@ -51,12 +69,70 @@ public:
     bool isExist(const string& appId);
     void toJson(JValue& json, JValue& properties, bool devmode = false);
 
+    // serialized 'apps' array of listApps without properties.
+    // It is built from serialized apps again only after the list is changed
+    const string& getSnapshot(bool devmode = false)
+    {
+        return *getSharedSnapshot(devmode);
+    }
+    shared_ptr<const string> getSharedSnapshot(bool devmode = false);
+
+    // puts all apps in the log. Removed apps are recorded as well
+    void syncDeltaLog(DeltaLog& deltaLog);
+
+    boost::signals2::signal<void()> EventFullyScanned;
+
 private:
+    static const int SCAN_CHUNK_SIZE = 4; // apps scanned per idle callback
+
+    static void onScanWorker(gpointer data, gpointer userData);
+    static gboolean onIdleScan(gpointer data);
+
     AppDescriptionList();
 
+    // scanApp without saving the catalog cache. dirFds are opened 'ApplicationPaths' (-1 if not opened)
+    void rescanApp(const string& appId, const vector<int>& dirFds);
+    void getLocations(vector<pair<string, string>>& locations);
+    void collectDir(const string& path, const AppLocation& appLocation, vector<AppDescriptionPtr>& candidates);
+    void collectApp(const string& path, const AppLocation& appLocation, const string& appId,
+                    vector<AppDescriptionPtr>& candidates, bool checkDirectory = true);
+    void scanParallel(vector<AppDescriptionPtr>& candidates);
+    void addScanned(vector<AppDescriptionPtr>& candidates);
+
     void onRemove(AppDescriptionPtr appDesc);
+    void onFullyScanned();
+
+    // puts the app in both of m_map and m_index
+    void put(AppDescriptionPtr appDesc);
+
+    // lists the best copy of the app. The app is removed if there is no copy
+    void promote(const string& appId);
+    bool isListed(const AppDescriptionPtr& appDesc);
+    AppDescriptionPtr findCopy(Symbol appSymbol, const string& folderPath);
+    void putCopy(AppDescriptionPtr appDesc);
+    static size_t getPathOrder(const AppDescriptionPtr& appDesc);
+    void eraseCopy(Symbol appSymbol, const string& folderPath);
 
+    // sorted by appId for listing
     map<string, AppDescriptionPtr> m_map;
+    // appId symbol => app for lookup
+    unordered_map<Symbol, AppDescriptionPtr> m_index;
+    // appId symbol => scanned copies in all locations.
+    // Shadowed copies are listed without scanning when the listed one is removed
+    unordered_map<Symbol, vector<AppDescriptionPtr>> m_copies;
+
+    shared_ptr<const string> m_snapshot;
+    shared_ptr<const string> m_devmodeSnapshot;
+    bool m_isSnapshotValid;
+
+    // candidates which will be scanned in idle time
+    vector<AppDescriptionPtr> m_remaining;
+    size_t m_remainingIndex;
+    guint m_idleScanSource;
+    bool m_isFullyScanned;
+
+    // cache entries are kept if some of locations cannot be listed
+    bool m_isListingFailed;
 };
 
 #endif /* BASE_APPDESCRIPTIONLIST_H_ */
@@ -0,0 +1,256 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "base/AppDirectoryWatcher.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "base/AppDescription.h"
+#include "base/AppDescriptionList.h"
+#include "conf/SAMConf.h"
+#include "util/File.h"
+#include "util/Logger.h"
+
+static const uint32_t MASK_ROOT = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+static const uint32_t MASK_APP = IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                 IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+
+gboolean AppDirectoryWatcher::onReadEvents(GIOChannel* channel, GIOCondition condition, gpointer data)
+{
+    AppDirectoryWatcher* self = static_cast<AppDirectoryWatcher*>(data);
+    if (condition & (G_IO_ERR | G_IO_HUP)) {
+        Logger::error(self->getClassName(), __FUNCTION__, "inotify channel is closed");
+        self->m_channelWatch = 0;
+        return G_SOURCE_REMOVE;
+    }
+
+    char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+    while (true) {
+        ssize_t length = read(self->m_fd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno != EAGAIN)
+                Logger::warning(self->getClassName(), __FUNCTION__, Logger::format("Failed to read: %s", strerror(errno)));
+            break;
+        }
+
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(ptr);
+            self->handleEvent(event->wd, event->mask, event->len > 0 ? event->name : "");
+            ptr += sizeof(struct inotify_event) + event->len;
+        }
+    }
+    return G_SOURCE_CONTINUE;
+}
+
+gboolean AppDirectoryWatcher::onDebounceTimer(gpointer data)
+{
+    AppDirectoryWatcher* self = static_cast<AppDirectoryWatcher*>(data);
+    self->m_debounceTimer = 0;
+
+    set<string> appIds;
+    appIds.swap(self->m_pending);
+    for (const auto& appId : appIds) {
+        Logger::info(self->getClassName(), __FUNCTION__, appId, "Directory is changed");
+    }
+    AppDescriptionList::getInstance().scanApps(appIds);
+    return G_SOURCE_REMOVE;
+}
+
+AppDirectoryWatcher::AppDirectoryWatcher()
+    : m_fd(-1),
+      m_channel(NULL),
+      m_channelWatch(0),
+      m_debounceTimer(0),
+      m_firstPendingTime(0)
+{
+    setClassName("AppDirectoryWatcher");
+}
+
+AppDirectoryWatcher::~AppDirectoryWatcher()
+{
+    finalize();
+}
+
+void AppDirectoryWatcher::initialize()
+{
+    if (m_fd >= 0)
+        return;
+
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0) {
+        Logger::error(getClassName(), __FUNCTION__, Logger::format("Failed to init inotify: %s", strerror(errno)));
+        return;
+    }
+
+    for (const ApplicationPath& applicationPath : SAMConf::getInstance().getApplicationPaths()) {
+        const string& path = applicationPath.path;
+        AppLocation appLocation = AppDescription::toAppLocation(applicationPath.typeByDir);
+        if (path.empty() || appLocation == AppLocation::AppLocation_None) {
+            continue;
+        }
+        if (appLocation == AppLocation::AppLocation_Devmode && !SAMConf::getInstance().isDevmodeEnabled()) {
+            continue;
+        }
+        if (!File::isDirectory(path)) {
+            continue;
+        }
+        addRootWatch(path, appLocation);
+    }
+
+    m_channel = g_io_channel_unix_new(m_fd);
+    m_channelWatch = g_io_add_watch(m_channel, (GIOCondition) (G_IO_IN | G_IO_ERR | G_IO_HUP), onReadEvents, this);
+    Logger::info(getClassName(), __FUNCTION__,
+                 Logger::format("roots(%d) apps(%d)", (int) m_roots.size(), (int) m_apps.size()));
+}
+
+void AppDirectoryWatcher::finalize()
+{
+    if (m_debounceTimer > 0) {
+        g_source_remove(m_debounceTimer);
+        m_debounceTimer = 0;
+    }
+    if (m_channelWatch > 0) {
+        g_source_remove(m_channelWatch);
+        m_channelWatch = 0;
+    }
+    if (m_channel) {
+        g_io_channel_unref(m_channel);
+        m_channel = NULL;
+    }
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+    m_roots.clear();
+    m_apps.clear();
+    m_pending.clear();
+}
+
+void AppDirectoryWatcher::addRootWatch(const string& path, AppLocation appLocation)
+{
+    int wd = inotify_add_watch(m_fd, path.c_str(), MASK_ROOT);
+    if (wd < 0) {
+        Logger::warning(getClassName(), __FUNCTION__, path, Logger::format("Failed to add watch: %s", strerror(errno)));
+        return;
+    }
+    m_roots[wd] = make_pair(path, appLocation);
+
+    DIR* dir = opendir(path.c_str());
+    if (dir == NULL)
+        return;
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.')
+            continue;
+        if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN)
+            continue;
+        addAppWatch(File::join(path, entry->d_name), entry->d_name, appLocation);
+    }
+    closedir(dir);
+}
+
+void AppDirectoryWatcher::addAppWatch(const string& path, const string& appId, AppLocation appLocation)
+{
+    int wd = inotify_add_watch(m_fd, path.c_str(), MASK_APP);
+    if (wd < 0) {
+        // ENOTDIR is expected with DT_UNKNOWN
+        if (errno != ENOTDIR)
+            Logger::warning(getClassName(), __FUNCTION__, appId, Logger::format("Failed to add watch: %s", strerror(errno)));
+        return;
+    }
+    m_apps[wd] = make_pair(appId, appLocation);
+}
+
+void AppDirectoryWatcher::removeWatch(int wd)
+{
+    m_roots.erase(wd);
+    m_apps.erase(wd);
+}
+
+void AppDirectoryWatcher::handleEvent(int wd, uint32_t mask, const char* name)
+{
+    if (mask & IN_Q_OVERFLOW) {
+        // Some events are lost. Check all known apps and directories again
+        Logger::warning(getClassName(), __FUNCTION__, "inotify queue is overflowed");
+        map<int, pair<string, AppLocation>> roots = m_roots;
+        for (const auto& root : roots) {
+            addRootWatch(root.second.first, root.second.second);
+        }
+        for (const auto& app : m_apps) {
+            schedule(app.second.first, app.second.second);
+        }
+        return;
+    }
+
+    if (mask & IN_IGNORED) {
+        removeWatch(wd);
+        return;
+    }
+
+    auto root = m_roots.find(wd);
+    if (root != m_roots.end()) {
+        if (name[0] == '\0' || name[0] == '.')
+            return;
+        if ((mask & (IN_CREATE | IN_MOVED_TO)) && (mask & IN_ISDIR))
+            addAppWatch(File::join(root->second.first, name), name, root->second.second);
+        schedule(name, root->second.second);
+        return;
+    }
+
+    auto app = m_apps.find(wd);
+    if (app != m_apps.end()) {
+        string appId = app->second.first;
+        AppLocation appLocation = app->second.second;
+        if (mask & IN_MOVE_SELF) {
+            inotify_rm_watch(m_fd, wd);
+            removeWatch(wd);
+        } else if (!(mask & IN_DELETE_SELF) && strcmp(name, "appinfo.json") != 0) {
+            return;
+        }
+        schedule(appId, appLocation);
+    }
+}
+
+void AppDirectoryWatcher::schedule(const string& appId, AppLocation appLocation)
+{
+    if (SAMConf::getInstance().isBlockedApp(appId))
+        return;
+    // Same as 'collectApp'. Read-only copies of deleted system apps are never listed
+    if (appLocation == AppLocation::AppLocation_System_ReadOnly &&
+        SAMConf::getInstance().isDeletedSystemApp(appId))
+        return;
+
+    gint64 now = g_get_monotonic_time() / 1000;
+    if (m_pending.empty())
+        m_firstPendingTime = now;
+    m_pending.insert(appId);
+
+    // Steady writes postpone the rescan up to MAX_DELAY only
+    gint64 timeout = m_firstPendingTime + MAX_DELAY - now;
+    if (timeout > DEBOUNCE_TIMEOUT)
+        timeout = DEBOUNCE_TIMEOUT;
+    if (timeout < 0)
+        timeout = 0;
+
+    if (m_debounceTimer > 0)
+        g_source_remove(m_debounceTimer);
+    m_debounceTimer = g_timeout_add((guint) timeout, onDebounceTimer, this);
+}
@@ -0,0 +1,73 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BASE_APPDIRECTORYWATCHER_H_
+#define BASE_APPDIRECTORYWATCHER_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <glib.h>
+
+#include "base/AppDescription.h"
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+
+// AppDirectoryWatcher watches all 'ApplicationPaths' and app folders in them with inotify.
+// Changed appIds are collected during DEBOUNCE_TIMEOUT and rescanned with 'scanApps'.
+// The rescan is not postponed more than MAX_DELAY after the first pending change
+class AppDirectoryWatcher : public ISingleton<AppDirectoryWatcher>,
+                            public IClassName {
+friend class ISingleton<AppDirectoryWatcher>;
+public:
+    virtual ~AppDirectoryWatcher();
+
+    void initialize();
+    void finalize();
+
+private:
+    static const int DEBOUNCE_TIMEOUT = 500; // 0.5 second
+    static const int MAX_DELAY = 5000; // 5 seconds
+
+    static gboolean onReadEvents(GIOChannel* channel, GIOCondition condition, gpointer data);
+    static gboolean onDebounceTimer(gpointer data);
+
+    AppDirectoryWatcher();
+
+    void addRootWatch(const string& path, AppLocation appLocation);
+    void addAppWatch(const string& path, const string& appId, AppLocation appLocation);
+    void removeWatch(int wd);
+
+    void handleEvent(int wd, uint32_t mask, const char* name);
+    void schedule(const string& appId, AppLocation appLocation);
+
+    int m_fd;
+    GIOChannel* m_channel;
+    guint m_channelWatch;
+    guint m_debounceTimer;
+    // milliseconds in monotonic time when m_pending became non-empty
+    gint64 m_firstPendingTime;
+
+    // watch descriptor => (root directory path, location)
+    map<int, pair<string, AppLocation>> m_roots;
+    // watch descriptor => (appId, location)
+    map<int, pair<string, AppLocation>> m_apps;
+    set<string> m_pending;
+};
+
+#endif /* BASE_APPDIRECTORYWATCHER_H_ */
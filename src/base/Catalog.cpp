@@ -0,0 +1,68 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "base/Catalog.h"
+
+#include "base/AppDescriptionList.h"
+#include "base/LaunchPointList.h"
+#include "base/RunningAppList.h"
+#include "util/Logger.h"
+
+Catalog::Catalog()
+{
+    setClassName("Catalog");
+
+    shared_ptr<CatalogSnapshot> snapshot = make_shared<CatalogSnapshot>();
+    snapshot->generation = 0;
+    snapshot->apps = make_shared<const string>("[]");
+    snapshot->devmodeApps = snapshot->apps;
+    snapshot->launchPoints = snapshot->apps;
+    snapshot->running = snapshot->apps;
+    snapshot->devmodeRunning = snapshot->apps;
+    m_snapshot = snapshot;
+}
+
+Catalog::~Catalog()
+{
+}
+
+CatalogSnapshotPtr Catalog::update(int parts)
+{
+    // Lists rebuild their buffers only after they are changed. Same buffer means no change
+    shared_ptr<CatalogSnapshot> snapshot = make_shared<CatalogSnapshot>(*m_snapshot);
+    if (parts & CatalogPart_Apps) {
+        snapshot->apps = AppDescriptionList::getInstance().getSharedSnapshot(false);
+        snapshot->devmodeApps = AppDescriptionList::getInstance().getSharedSnapshot(true);
+    }
+    if (parts & CatalogPart_LaunchPoints) {
+        snapshot->launchPoints = LaunchPointList::getInstance().getSharedSnapshot();
+    }
+    if (parts & CatalogPart_Running) {
+        snapshot->running = RunningAppList::getInstance().getSharedSnapshot(false);
+        snapshot->devmodeRunning = RunningAppList::getInstance().getSharedSnapshot(true);
+    }
+    if (snapshot->apps == m_snapshot->apps &&
+        snapshot->devmodeApps == m_snapshot->devmodeApps &&
+        snapshot->launchPoints == m_snapshot->launchPoints &&
+        snapshot->running == m_snapshot->running &&
+        snapshot->devmodeRunning == m_snapshot->devmodeRunning)
+        return m_snapshot;
+
+    snapshot->generation = m_snapshot->generation + 1;
+    m_snapshot = snapshot;
+    Logger::debug(getClassName(), __FUNCTION__, Logger::format("generation(%lu)", m_snapshot->generation));
+    return m_snapshot;
+}
@@ -0,0 +1,75 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BASE_CATALOG_H_
+#define BASE_CATALOG_H_
+
+#include <memory>
+#include <string>
+
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+
+// Immutable view of apps, launch points and running apps.
+// It is never changed after it is published. A reply can keep using it while lists are changed.
+// Serialized arrays are shared with the lists which built them and with previous snapshot.
+struct CatalogSnapshot {
+    unsigned long generation;
+
+    // serialized arrays
+    shared_ptr<const string> apps;
+    shared_ptr<const string> devmodeApps;
+    shared_ptr<const string> launchPoints;
+    shared_ptr<const string> running;
+    shared_ptr<const string> devmodeRunning;
+};
+
+typedef shared_ptr<const CatalogSnapshot> CatalogSnapshotPtr;
+
+// Catalog publishes new CatalogSnapshot with new generation after lists are changed.
+// Replies of listApps, listLaunchPoints and running carry the generation they are built from.
+// Lists are main thread only. So Catalog is also used only in main thread.
+class Catalog : public ISingleton<Catalog>,
+                public IClassName {
+friend class ISingleton<Catalog>;
+public:
+    enum CatalogPart {
+        CatalogPart_Apps = 1,
+        CatalogPart_LaunchPoints = 2,
+        CatalogPart_Running = 4,
+        CatalogPart_All = 7,
+    };
+
+    virtual ~Catalog();
+
+    CatalogSnapshotPtr get() const
+    {
+        return m_snapshot;
+    }
+
+    // New snapshot is published only if the parts are changed. Other parts are not checked.
+    // Lists are asked every time because launch points can be changed without any post
+    CatalogSnapshotPtr update(int parts = CatalogPart_All);
+
+private:
+    Catalog();
+
+    CatalogSnapshotPtr m_snapshot;
+};
+
+#endif /* BASE_CATALOG_H_ */
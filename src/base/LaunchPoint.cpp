@@ -47,7 +47,9 @@ LaunchPoint::LaunchPoint(AppDescriptionPtr appDesc, const string& launchPointId)
     : m_type(LaunchPointType::LaunchPoint_UNKNOWN),
       m_appDesc(std::move(appDesc)),
       m_launchPointId(launchPointId),
-      m_isDirty(false)
+      m_launchPointSymbol(SymbolTable::getInstance().intern(launchPointId)),
+      m_isDirty(false),
+      m_jsonRevision(0)
 {
     m_database = pbnjson::Object();
 }
@@ -85,6 +87,7 @@ void LaunchPoint::setDatabase(const JValue& database)
 {
     // This method should be called by DB8 instance
     m_database = database.duplicate();
+    invalidate();
 }
 
 void LaunchPoint::updateDatabase(const JValue& json)
@@ -95,17 +98,38 @@ void LaunchPoint::updateDatabase(const JValue& json)
         if (!m_database.hasKey(key)) {
             m_database.put(key, obj.second);
             m_isDirty = true;
+            invalidate();
             continue;
         }
 
         if (m_database[key] != obj.second) {
             m_database.put(key, obj.second);
             m_isDirty = true;
+            invalidate();
         }
     }
 }
 
-void LaunchPoint::toJson(JValue& json) const
+const JValue& LaunchPoint::getJson()
+{
+    if (m_json.isNull() || m_jsonRevision != m_appDesc->getRevision()) {
+        m_snapshot.clear();
+        m_json = pbnjson::Object();
+        materialize(m_json);
+        m_jsonRevision = m_appDesc->getRevision();
+    }
+    return m_json;
+}
+
+const string& LaunchPoint::getSnapshot()
+{
+    const JValue& json = getJson();
+    if (m_snapshot.empty())
+        m_snapshot = json.stringify();
+    return m_snapshot;
+}
+
+void LaunchPoint::materialize(JValue& json) const
 {
     m_appDesc->toJson(json);
     for (JValue::KeyValue obj : m_database.children()) {
@@ -47,9 +47,10 @@ public:
     static string toString(const LaunchPointType type);
     static LaunchPointType toEnum(const string& type);
 
-    static bool compareTitle(LaunchPointPtr a, LaunchPointPtr b)
+    // sort keys are built by LaunchPointList with the collator of current locale
+    static bool compareTitle(const LaunchPointPtr& a, const LaunchPointPtr& b)
     {
-        return a->getTitle() < b->getTitle();
+        return a->m_sortKey < b->m_sortKey;
     }
 
     LaunchPoint(AppDescriptionPtr appDesc, const string& launchPointId);
@@ -62,6 +63,7 @@ public:
     void setType(const LaunchPointType type)
     {
         m_type = type;
+        invalidate();
     }
 
     AppDescriptionPtr getAppDesc() const
@@ -71,18 +73,29 @@ public:
     void setAppDesc(AppDescriptionPtr appDesc)
     {
         m_appDesc = std::move(appDesc);
+        invalidate();
     }
 
-    const string getAppId() const
+    const string& getAppId() const
     {
         return m_appDesc->getAppId();
     }
 
+    Symbol getAppSymbol() const
+    {
+        return m_appDesc->getAppSymbol();
+    }
+
     const string& getLaunchPointId() const
     {
         return m_launchPointId;
     }
 
+    Symbol getLaunchPointSymbol() const
+    {
+        return m_launchPointSymbol;
+    }
+
     void syncDatabase();
     void setDatabase(const JValue& database);
     void updateDatabase(const JValue& json);
@@ -193,19 +206,51 @@ public:
         return m_appDesc->isVisible();
     }
 
-    void toJson(JValue& json) const;
+    // materialized json of appinfo and database. It is reused until database or appinfo is changed.
+    // Callers should not modify it. Use 'toJson' for modifiable copy
+    const JValue& getJson();
+
+    void toJson(JValue& json)
+    {
+        json = getJson().duplicate();
+    }
+
+    // serialized 'getJson' result
+    const string& getSnapshot();
+
+    bool isSnapshotValid() const
+    {
+        return !m_snapshot.empty() && m_jsonRevision == m_appDesc->getRevision();
+    }
 
 private:
     LaunchPoint(const LaunchPoint&);
     LaunchPoint& operator=(const LaunchPoint&) const;
 
+    void materialize(JValue& json) const;
+
+    void invalidate()
+    {
+        m_json = JValue();
+        m_snapshot.clear();
+    }
+
     LaunchPointType m_type;
     AppDescriptionPtr m_appDesc;
     string m_launchPointId;
+    Symbol m_launchPointSymbol;
 
     bool m_isDirty;
     JValue m_database;
 
+    // appinfo revision which m_json is built from. locale change is detected with this
+    JValue m_json;
+    unsigned int m_jsonRevision;
+    string m_snapshot;
+
+    // ICU collation key of title. It is managed by LaunchPointList
+    string m_sortKey;
+
 };
 
 #endif /* LAUNCH_POINT_H */
@@ -17,16 +17,26 @@
 #include "base/LaunchPointList.h"
 
 #include <sys/time.h>
-#include <boost/lexical_cast.hpp>
+#include <unicode/locid.h>
 
 #include "RunningAppList.h"
 #include "bus/client/DB8.h"
 #include "bus/service/ApplicationManager.h"
+#include "conf/SAMConf.h"
 #include "util/JValueUtil.h"
 
 LaunchPointList::LaunchPointList()
+    : m_bookmarkSequence(0),
+      m_isSnapshotValid(false)
 {
     setClassName("LaunchPointList");
+
+    // Sequence starts from current time. So new ids are not overlapped with ids in DB8
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    m_bookmarkSequence = (unsigned long long) tv.tv_sec * 1000000ULL + tv.tv_usec;
+
+    createCollator();
 }
 
 LaunchPointList::~LaunchPointList()
@@ -37,11 +47,46 @@ LaunchPointList::~LaunchPointList()
 void LaunchPointList::clear()
 {
     m_list.clear();
+    m_index.clear();
+    m_appIdIndex.clear();
+    m_titleIndex.clear();
+    m_isSnapshotValid = false;
 }
 
-void LaunchPointList::sort()
+void LaunchPointList::changeLocale()
 {
+    createCollator();
+    for (const auto& launchPoint : m_list) {
+        launchPoint->m_sortKey = toSortKey(launchPoint->getTitle());
+    }
+
+    // list::sort doesn't invalidate iterators in m_index
     m_list.sort(LaunchPoint::compareTitle);
+    m_titleIndex.clear();
+    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
+        m_titleIndex.emplace_hint(m_titleIndex.end(), (*it)->m_sortKey, it);
+    }
+    m_isSnapshotValid = false;
+
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("sorted(%d)", (int) m_list.size()));
+    if (!m_list.empty())
+        ApplicationManager::getInstance().postListLaunchPoints(nullptr, "");
+}
+
+void LaunchPointList::reorder(LaunchPointPtr launchPoint)
+{
+    auto it = m_index.find(launchPoint->getLaunchPointSymbol());
+    if (it == m_index.end() || *(it->second) != launchPoint)
+        return;
+
+    string sortKey = toSortKey(launchPoint->getTitle());
+    if (sortKey == launchPoint->m_sortKey)
+        return;
+
+    unplace(it->second);
+    launchPoint->m_sortKey = std::move(sortKey);
+    place(it->second);
+    m_isSnapshotValid = false;
 }
 
 LaunchPointPtr LaunchPointList::createBootmarkByAPI(AppDescriptionPtr appDesc, const JValue& database)
@@ -108,8 +153,13 @@ LaunchPointPtr LaunchPointList::getByAppId(const string& appId)
     if (appId.empty())
         return nullptr;
 
-    string launchPointId = generateLaunchPointId(LaunchPointType::LaunchPoint_DEFAULT, appId);
-    return getByLaunchPointId(launchPointId);
+    // Only launch points of the app are checked. Default launch point is one per app
+    auto range = m_appIdIndex.equal_range(SymbolTable::getInstance().find(appId));
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->getType() == LaunchPointType::LaunchPoint_DEFAULT)
+            return it->second;
+    }
+    return nullptr;
 }
 
 LaunchPointPtr LaunchPointList::getByLaunchPointId(const string& launchPointId)
@@ -117,12 +167,10 @@ LaunchPointPtr LaunchPointList::getByLaunchPointId(const string& launchPointId)
     if (launchPointId.empty())
         return nullptr;
 
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getLaunchPointId() == launchPointId) {
-            return *it;
-        }
-    }
-    return nullptr;
+    auto it = m_index.find(SymbolTable::getInstance().find(launchPointId));
+    if (it == m_index.end())
+        return nullptr;
+    return *(it->second);
 }
 
 bool LaunchPointList::add(LaunchPointPtr launchPoint)
@@ -142,22 +190,22 @@ bool LaunchPointList::add(LaunchPointPtr launchPoint)
 
 bool LaunchPointList::remove(LaunchPointPtr launchPoint)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it) == launchPoint) {
-            m_list.erase(it);
-            onRemove(launchPoint);
-            return true;
-        }
-    }
+    auto it = m_index.find(launchPoint->getLaunchPointSymbol());
+    if (it == m_index.end() || *(it->second) != launchPoint)
+        return true;
+
+    erase(it->second);
+    onRemove(launchPoint);
     return true;
 }
 
 bool LaunchPointList::update(AppDescriptionPtr oldAppDesc, AppDescriptionPtr newAppDesc)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getAppDesc() == oldAppDesc) {
-            (*it)->setAppDesc(newAppDesc);
-            onUpdate(*it);
+    auto range = m_appIdIndex.equal_range(oldAppDesc->getAppSymbol());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->getAppDesc() == oldAppDesc) {
+            it->second->setAppDesc(newAppDesc);
+            onUpdate(it->second);
         }
     }
     return true;
@@ -165,40 +213,42 @@ bool LaunchPointList::update(AppDescriptionPtr oldAppDesc, AppDescriptionPtr new
 
 void LaunchPointList::removeByAppDesc(AppDescriptionPtr appDesc)
 {
-    for (auto it = m_list.begin(); it != m_list.end();) {
-        if ((*it)->getAppDesc() == appDesc) {
-            LaunchPointPtr launchPoint = *it;
-            it = m_list.erase(it);
-            onRemove(std::move(launchPoint));
-        } else {
-            ++it;
-        }
+    vector<LaunchPointPtr> launchPoints;
+    auto range = m_appIdIndex.equal_range(appDesc->getAppSymbol());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->getAppDesc() == appDesc)
+            launchPoints.push_back(it->second);
+    }
+
+    for (auto& launchPoint : launchPoints) {
+        erase(m_index[launchPoint->getLaunchPointSymbol()]);
+        onRemove(std::move(launchPoint));
     }
 }
 
 void LaunchPointList::removeByAppId(const string& appId)
 {
-    for (auto it = m_list.begin(); it != m_list.end();) {
-        if ((*it)->getAppDesc()->getAppId() == appId) {
-            LaunchPointPtr launchPoint = *it;
-            it = m_list.erase(it);
-            onRemove(std::move(launchPoint));
-        } else {
-            ++it;
-        }
+    vector<LaunchPointPtr> launchPoints;
+    auto range = m_appIdIndex.equal_range(SymbolTable::getInstance().find(appId));
+    for (auto it = range.first; it != range.second; ++it) {
+        launchPoints.push_back(it->second);
+    }
+
+    for (auto& launchPoint : launchPoints) {
+        erase(m_index[launchPoint->getLaunchPointSymbol()]);
+        onRemove(std::move(launchPoint));
     }
 }
 
 void LaunchPointList::removeByLaunchPointId(const string& launchPointId)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getLaunchPointId() == launchPointId) {
-            LaunchPointPtr launchPoint = *it;
-            it = m_list.erase(it);
-            onRemove(std::move(launchPoint));
-            return;
-        }
-    }
+    auto it = m_index.find(SymbolTable::getInstance().find(launchPointId));
+    if (it == m_index.end())
+        return;
+
+    LaunchPointPtr launchPoint = *(it->second);
+    erase(it->second);
+    onRemove(std::move(launchPoint));
 }
 
 bool LaunchPointList::isExist(const string& launchPointId)
@@ -206,11 +256,7 @@ bool LaunchPointList::isExist(const string& launchPointId)
     if (launchPointId.empty())
         return false;
 
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getLaunchPointId() == launchPointId)
-            return true;
-    }
-    return false;
+    return m_index.find(SymbolTable::getInstance().find(launchPointId)) != m_index.end();
 }
 
 void LaunchPointList::toJson(JValue& json)
@@ -221,50 +267,153 @@ void LaunchPointList::toJson(JValue& json)
 
     for (auto it = m_list.begin(); it != m_list.end(); ++it) {
         if ((*it)->isVisible()) {
-            JValue item;
-            (*it)->toJson(item);
-            json.append(item);
+            json.append((*it)->getJson());
         }
     }
 }
 
+shared_ptr<const string> LaunchPointList::getSharedSnapshot()
+{
+    // launch points can be changed by database or appinfo without notifying the list
+    if (m_isSnapshotValid) {
+        for (const auto& launchPoint : m_list) {
+            if (!launchPoint->isSnapshotValid()) {
+                m_isSnapshotValid = false;
+                break;
+            }
+        }
+    }
+    if (m_isSnapshotValid)
+        return m_snapshot;
+
+    string snapshot = "[";
+    for (const auto& launchPoint : m_list) {
+        // invisible launch points are also serialized to check their validity above
+        const string& item = launchPoint->getSnapshot();
+        if (!launchPoint->isVisible())
+            continue;
+        if (snapshot.size() > 1)
+            snapshot += ",";
+        snapshot += item;
+    }
+    snapshot += "]";
+    m_snapshot = make_shared<const string>(std::move(snapshot));
+    m_isSnapshotValid = true;
+    return m_snapshot;
+}
+
+void LaunchPointList::syncDeltaLog(DeltaLog& deltaLog)
+{
+    deltaLog.beginSync();
+    for (const auto& launchPoint : m_list) {
+        if (launchPoint->isVisible())
+            deltaLog.put(launchPoint->getLaunchPointId(), launchPoint->getJson(), launchPoint->getSnapshot());
+    }
+    deltaLog.endSync();
+}
+
 string LaunchPointList::generateLaunchPointId(LaunchPointType type, const string& appId)
 {
     if (type == LaunchPointType::LaunchPoint_DEFAULT) {
         return appId + "_default";
     }
 
+    // Bookmarks from DB8 can have any number. Those are skipped
     string launchPointId;
-    while (true) {
-        struct timeval tv;
-        gettimeofday(&tv, NULL);
-        double verifier = tv.tv_usec;
+    do {
+        launchPointId = appId + "_" + to_string(++m_bookmarkSequence);
+    } while (isExist(launchPointId));
+    return launchPointId;
+}
 
-        launchPointId = appId + "_" + boost::lexical_cast<string>(verifier);
-        if (LaunchPointList::getInstance().getByLaunchPointId(launchPointId) == nullptr)
+void LaunchPointList::erase(list<LaunchPointPtr>::iterator it)
+{
+    auto range = m_appIdIndex.equal_range((*it)->getAppSymbol());
+    for (auto app = range.first; app != range.second; ++app) {
+        if (app->second == *it) {
+            m_appIdIndex.erase(app);
             break;
+        }
     }
+    unplace(it);
+    m_index.erase((*it)->getLaunchPointSymbol());
+    m_list.erase(it);
+}
 
-    return launchPointId;
+void LaunchPointList::createCollator()
+{
+    string name = SAMConf::getInstance().getLanguage();
+    if (!SAMConf::getInstance().getScript().empty())
+        name += "_" + SAMConf::getInstance().getScript();
+    if (!SAMConf::getInstance().getRegion().empty())
+        name += "_" + SAMConf::getInstance().getRegion();
+
+    UErrorCode status = U_ZERO_ERROR;
+    m_collator.reset(icu::Collator::createInstance(icu::Locale::createFromName(name.c_str()), status));
+    if (U_FAILURE(status)) {
+        Logger::warning(getClassName(), __FUNCTION__, name, Logger::format("Failed to create collator: %s", u_errorName(status)));
+        m_collator.reset();
+    }
+}
+
+string LaunchPointList::toSortKey(const string& title) const
+{
+    // titles are compared as they are without collator
+    if (!m_collator)
+        return title;
+
+    icu::UnicodeString source = icu::UnicodeString::fromUTF8(title);
+    int32_t length = m_collator->getSortKey(source, nullptr, 0);
+    string sortKey(length, '\0');
+    m_collator->getSortKey(source, reinterpret_cast<uint8_t*>(&sortKey[0]), length);
+    return sortKey;
+}
+
+void LaunchPointList::place(list<LaunchPointPtr>::iterator it)
+{
+    // Same titles are kept in insertion order
+    auto next = m_titleIndex.upper_bound((*it)->m_sortKey);
+    m_list.splice(next == m_titleIndex.end() ? m_list.end() : next->second, m_list, it);
+    m_titleIndex.emplace_hint(next, (*it)->m_sortKey, it);
+}
+
+void LaunchPointList::unplace(list<LaunchPointPtr>::iterator it)
+{
+    auto range = m_titleIndex.equal_range((*it)->m_sortKey);
+    for (auto title = range.first; title != range.second; ++title) {
+        if (title->second == it) {
+            m_titleIndex.erase(title);
+            break;
+        }
+    }
 }
 
 void LaunchPointList::onAdd(LaunchPointPtr launchPoint)
 {
     Logger::info(getClassName(), __FUNCTION__, launchPoint->getLaunchPointId() + " is added");
     launchPoint->syncDatabase();
+    launchPoint->m_sortKey = toSortKey(launchPoint->getTitle());
     m_list.push_back(launchPoint);
+    m_index[launchPoint->getLaunchPointSymbol()] = prev(m_list.end());
+    place(prev(m_list.end()));
+    m_appIdIndex.insert(make_pair(launchPoint->getAppSymbol(), launchPoint));
+    m_isSnapshotValid = false;
     ApplicationManager::getInstance().postListLaunchPoints(std::move(launchPoint), "added");
 }
 
 void LaunchPointList::onUpdate(LaunchPointPtr launchPoint)
 {
     Logger::info(getClassName(), __FUNCTION__, launchPoint->getLaunchPointId() + " is updated");
+    reorder(launchPoint);
+    m_isSnapshotValid = false;
+    RunningAppList::getInstance().updateAllByLaunchPoint(launchPoint);
     ApplicationManager::getInstance().postListLaunchPoints(std::move(launchPoint), "updated");
 }
 
 void LaunchPointList::onRemove(LaunchPointPtr launchPoint)
 {
     Logger::info(getClassName(), __FUNCTION__, launchPoint->getLaunchPointId() + " is removed");
+    m_isSnapshotValid = false;
     RunningAppList::getInstance().removeAllByLaunchPoint(launchPoint);
     DB8::getInstance().deleteLaunchPoint(launchPoint->getLaunchPointId());
     ApplicationManager::getInstance().postListLaunchPoints(std::move(launchPoint), "removed");
@@ -19,10 +19,15 @@
 
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <unicode/coll.h>
 
 #include "base/LunaTask.h"
 #include "interface/ISingleton.h"
 #include "interface/IClassName.h"
+#include "util/DeltaLog.h"
 #include "LaunchPoint.h"
 
 using namespace std;
@@ -34,7 +39,12 @@ public:
     virtual ~LaunchPointList();
 
     void clear();
-    void sort();
+
+    // Launch points are kept in title order of current locale.
+    // All sort keys are built again only when locale is changed
+    void changeLocale();
+    // moves the launch point if its title is changed
+    void reorder(LaunchPointPtr launchPoint);
 
     LaunchPointPtr createBootmarkByAPI(AppDescriptionPtr appDesc, const JValue& database);
     LaunchPointPtr createBootmarkByDB(AppDescriptionPtr appDesc, const JValue& database);
@@ -54,6 +64,17 @@ public:
     bool isExist(const string& launchPointId);
     void toJson(JValue& json);
 
+    // serialized 'launchPoints' array of listLaunchPoints.
+    // Only changed launch points are serialized again
+    const string& getSnapshot()
+    {
+        return *getSharedSnapshot();
+    }
+    shared_ptr<const string> getSharedSnapshot();
+
+    // puts all visible launch points in the log. Others are recorded as removed
+    void syncDeltaLog(DeltaLog& deltaLog);
+
 private:
     string generateLaunchPointId(LaunchPointType type, const string& appId);
 
@@ -63,7 +84,27 @@ private:
     void onUpdate(LaunchPointPtr launchPoint);
     void onRemove(LaunchPointPtr launchPoint);
 
+    // removes launch point from list and indexes
+    void erase(list<LaunchPointPtr>::iterator it);
+
+    void createCollator();
+    string toSortKey(const string& title) const;
+    // moves the launch point to the position of its sort key
+    void place(list<LaunchPointPtr>::iterator it);
+    void unplace(list<LaunchPointPtr>::iterator it);
+
     list<LaunchPointPtr> m_list;
+    // launchPointId symbol => position in m_list
+    unordered_map<Symbol, list<LaunchPointPtr>::iterator> m_index;
+    // appId symbol => launch points
+    unordered_multimap<Symbol, LaunchPointPtr> m_appIdIndex;
+    // sort key => position in m_list. m_list is always in this order
+    multimap<string, list<LaunchPointPtr>::iterator> m_titleIndex;
+    unique_ptr<icu::Collator> m_collator;
+    unsigned long long m_bookmarkSequence;
+
+    shared_ptr<const string> m_snapshot;
+    bool m_isSnapshotValid;
 };
 
 #endif /* BASE_LAUNCHPOINTLIST_H_ */
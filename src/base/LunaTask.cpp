@@ -17,11 +17,39 @@
 #include "LunaTask.h"
 
 #include "AppDescriptionList.h"
+#include "LunaTaskList.h"
 #include "RunningAppList.h"
 #include "util/JValueUtil.h"
 
 #define LOG_NAME "LunaTask"
 
+void LunaTask::setInstanceId(const string& instanceId)
+{
+    if (m_isListed)
+        LunaTaskList::getInstance().removeIndexes(*this);
+    m_instanceId = instanceId;
+    if (m_isListed)
+        LunaTaskList::getInstance().addIndexes(*this);
+}
+
+void LunaTask::setAppId(const string& appId)
+{
+    if (m_isListed)
+        LunaTaskList::getInstance().removeIndexes(*this);
+    m_appId = appId;
+    if (m_isListed)
+        LunaTaskList::getInstance().addIndexes(*this);
+}
+
+void LunaTask::setToken(LSMessageToken token)
+{
+    if (m_isListed)
+        LunaTaskList::getInstance().removeIndexes(*this);
+    m_token = token;
+    if (m_isListed)
+        LunaTaskList::getInstance().addIndexes(*this);
+}
+
 int LunaTask::getDisplayId()
 {
     int displayId = -1;
@@ -52,7 +52,8 @@ public:
           m_responsePayload(pbnjson::Object()),
           m_errorCode(ErrCode_NOERROR),
           m_errorText(""),
-          m_reason("")
+          m_reason(""),
+          m_isListed(false)
     {
         JValueUtil::getValue(m_requestPayload, "instanceId", m_instanceId);
         JValueUtil::getValue(m_requestPayload, "launchPointId", m_launchPointId);
@@ -68,10 +69,7 @@ public:
     {
         return m_instanceId;
     }
-    void setInstanceId(const string& instanceId)
-    {
-        m_instanceId = instanceId;
-    }
+    void setInstanceId(const string& instanceId);
 
     const string& getLaunchPointId() const
     {
@@ -86,10 +84,7 @@ public:
     {
         return m_appId;
     }
-    void setAppId(const string& appId)
-    {
-        m_appId = appId;
-    }
+    void setAppId(const string& appId);
 
     const string& getId() const
     {
@@ -114,10 +109,7 @@ public:
     {
         return m_token;
     }
-    void setToken(LSMessageToken token)
-    {
-        m_token = token;
-    }
+    void setToken(LSMessageToken token);
 
     const JValue& getRequestPayload() const
     {
@@ -129,6 +121,13 @@ public:
         return m_responsePayload;
     }
 
+    // 'serialized' is appended to response payload without parsing it again.
+    // Shared buffer is kept until reply. So it is copied only into the reply
+    void putSerializedResponse(const string& key, shared_ptr<const string> serialized)
+    {
+        m_serializedResponses.push_back(make_pair(key, std::move(serialized)));
+    }
+
     JValue getParams()
     {
         if (m_requestPayload.hasKey("params"))
@@ -264,7 +263,12 @@ private:
             returnValue = false;
         }
         m_responsePayload.put("returnValue", returnValue);
-        m_request.respond(m_responsePayload.stringify().c_str());
+
+        string responsePayload = m_responsePayload.stringify();
+        for (const auto& serialized : m_serializedResponses) {
+            JValueUtil::putSerialized(responsePayload, serialized.first, *serialized.second);
+        }
+        m_request.respond(responsePayload.c_str());
     }
 
     string m_instanceId;
@@ -276,6 +280,7 @@ private:
 
     JValue m_requestPayload;
     JValue m_responsePayload;
+    list<pair<string, shared_ptr<const string>>> m_serializedResponses;
 
     int m_errorCode;
     string m_errorText;
@@ -286,6 +291,10 @@ private:
     LunaTaskCallback m_errorCallback;
 
     string m_nextStep;
+
+    // position in LunaTaskList
+    list<LunaTaskPtr>::iterator m_position;
+    bool m_isListed;
 };
 
 #endif  // BASE_LUNATASK_H_
@@ -29,6 +29,7 @@ LunaTaskList::~LunaTaskList()
 
 LunaTaskPtr LunaTaskList::getByKindAndId(const char* kind, const string& appId)
 {
+    // appIds come from client payloads. Those are not interned for an index
     for (auto it = m_list.begin(); it != m_list.end(); ++it) {
         if (strcmp((*it)->getRequest().getKind(), kind) == 0 && (*it)->getAppId() == appId)
             return *it;
@@ -38,43 +39,45 @@ LunaTaskPtr LunaTaskList::getByKindAndId(const char* kind, const string& appId)
 
 LunaTaskPtr LunaTaskList::getByInstanceId(const string& instanceId)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getInstanceId() == instanceId)
-            return *it;
-    }
-    return nullptr;
+    auto it = m_instanceIdIndex.find(instanceId);
+    if (it == m_instanceIdIndex.end())
+        return nullptr;
+    return *(it->second->m_position);
 }
 
 LunaTaskPtr LunaTaskList::getByToken(const LSMessageToken& token)
 {
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it)->getToken() == token)
-            return *it;
-    }
-    return nullptr;
+    auto it = m_tokenIndex.find(token);
+    if (it == m_tokenIndex.end())
+        return nullptr;
+    return *(it->second->m_position);
 }
 
 bool LunaTaskList::add(LunaTaskPtr lunaTask)
 {
+    if (lunaTask == nullptr || lunaTask->m_isListed)
+        return false;
+
     m_list.push_back(lunaTask);
+    lunaTask->m_position = prev(m_list.end());
+    lunaTask->m_isListed = true;
+    addIndexes(*lunaTask);
     return true;
 }
 
 void LunaTaskList::removeAfterReply(LunaTaskPtr lunaTask, bool fillIds)
 {
     if (lunaTask == nullptr) return;
+    if (!lunaTask->m_isListed) return;
 
-    for (auto it = m_list.begin(); it != m_list.end(); ++it) {
-        if ((*it) == lunaTask) {
-            if (fillIds) {
-                (*it)->fillIds((*it)->getResponsePayload());
-            }
-            (*it)->reply();
-            m_list.erase(it);
-            return;
-        }
+    if (fillIds) {
+        lunaTask->fillIds(lunaTask->getResponsePayload());
     }
-    return;
+    lunaTask->reply();
+
+    removeIndexes(*lunaTask);
+    lunaTask->m_isListed = false;
+    m_list.erase(lunaTask->m_position);
 }
 
 void LunaTaskList::toJson(JValue& array)
@@ -88,3 +91,31 @@ void LunaTaskList::toJson(JValue& array)
         array.append(object);
     }
 }
+
+void LunaTaskList::addIndexes(LunaTask& lunaTask)
+{
+    if (!lunaTask.getInstanceId().empty())
+        m_instanceIdIndex.insert(make_pair(lunaTask.getInstanceId(), &lunaTask));
+    if (lunaTask.getToken() != 0)
+        m_tokenIndex.insert(make_pair(lunaTask.getToken(), &lunaTask));
+}
+
+template <typename K>
+static void eraseIndex(unordered_multimap<K, LunaTask*>& index, const K& key, LunaTask* lunaTask)
+{
+    auto range = index.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == lunaTask) {
+            index.erase(it);
+            return;
+        }
+    }
+}
+
+void LunaTaskList::removeIndexes(LunaTask& lunaTask)
+{
+    if (!lunaTask.getInstanceId().empty())
+        eraseIndex(m_instanceIdIndex, lunaTask.getInstanceId(), &lunaTask);
+    if (lunaTask.getToken() != 0)
+        eraseIndex(m_tokenIndex, lunaTask.getToken(), &lunaTask);
+}
@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "interface/ISingleton.h"
 #include "LunaTask.h"
@@ -27,6 +28,7 @@ using namespace std;
 
 class LunaTaskList : public ISingleton<LunaTaskList> {
 friend class ISingleton<LunaTaskList>;
+friend class LunaTask;
 public:
     virtual ~LunaTaskList();
 
@@ -44,7 +46,16 @@ public:
 private:
     LunaTaskList();
 
+    // Called by LunaTask when indexed value is changed
+    void addIndexes(LunaTask& lunaTask);
+    void removeIndexes(LunaTask& lunaTask);
+
+    // Each task knows its position. So it is removed without searching
     list<LunaTaskPtr> m_list;
+
+    // Empty ids and zero token are not indexed
+    unordered_multimap<string, LunaTask*> m_instanceIdIndex;
+    unordered_multimap<LSMessageToken, LunaTask*> m_tokenIndex;
 };
 
 #endif /* BASE_LUNATASKLIST_H_ */
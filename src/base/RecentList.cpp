@@ -0,0 +1,214 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "base/RecentList.h"
+
+#include <stdio.h>
+
+#include "base/AppDescriptionList.h"
+#include "bus/client/LSM.h"
+#include "conf/RuntimeInfo.h"
+#include "conf/SAMConf.h"
+#include "util/File.h"
+#include "util/JValueUtil.h"
+#include "util/Logger.h"
+
+gboolean RecentList::onSaveTimer(gpointer data)
+{
+    RecentList* self = static_cast<RecentList*>(data);
+    self->save();
+    return G_SOURCE_REMOVE;
+}
+
+RecentList::RecentList()
+    : m_saveTimer(onSaveTimer, this)
+{
+    setClassName("RecentList");
+}
+
+RecentList::~RecentList()
+{
+}
+
+void RecentList::initialize()
+{
+    if (!RuntimeInfo::getInstance().getHome().empty()) {
+        m_path = RuntimeInfo::getInstance().getHome() + "/.config/sam-recents.json";
+    } else {
+        m_path = SAMConf::getInstance().getRecentsPath();
+    }
+    load();
+}
+
+void RecentList::finalize()
+{
+    // pending changes are written before exit
+    if (m_saveTimer.isActive()) {
+        m_saveTimer.stop();
+        save();
+    }
+}
+
+void RecentList::moveToFront(int displayId, const string& appId, const string& launchPointId)
+{
+    if (appId.empty())
+        return;
+
+    Display& display = m_displays[displayId];
+    Symbol appSymbol = SymbolTable::getInstance().intern(appId);
+    auto it = display.index.find(appSymbol);
+    if (it != display.index.end()) {
+        if (it->second == display.recents.begin() && it->second->launchPointId == launchPointId)
+            return;
+        it->second->launchPointId = launchPointId;
+        display.recents.splice(display.recents.begin(), display.recents, it->second);
+    } else {
+        display.recents.push_front({ appId, launchPointId });
+        display.index[appSymbol] = display.recents.begin();
+    }
+    notify("moveToFront", displayId, display.recents.front());
+
+    if ((int) display.recents.size() > MAX_RECENTS) {
+        erase(displayId, display, prev(display.recents.end()));
+    }
+    m_saveTimer.start(SAVE_DELAY);
+}
+
+void RecentList::removeByAppId(const string& appId)
+{
+    Symbol appSymbol = SymbolTable::getInstance().find(appId);
+    if (appSymbol == SYMBOL_NONE)
+        return;
+
+    bool isChanged = false;
+    for (auto& display : m_displays) {
+        auto it = display.second.index.find(appSymbol);
+        if (it == display.second.index.end())
+            continue;
+        erase(display.first, display.second, it->second);
+        isChanged = true;
+    }
+    if (isChanged)
+        m_saveTimer.start(SAVE_DELAY);
+}
+
+void RecentList::prune()
+{
+    vector<string> appIds;
+    for (const auto& display : m_displays) {
+        for (const auto& recent : display.second.recents) {
+            if (!AppDescriptionList::getInstance().isExist(recent.appId))
+                appIds.push_back(recent.appId);
+        }
+    }
+    for (const auto& appId : appIds) {
+        removeByAppId(appId);
+    }
+}
+
+void RecentList::toJson(JValue& json, int displayId)
+{
+    if (!json.isArray())
+        return;
+
+    for (const auto& display : m_displays) {
+        if (displayId >= 0 && display.first != displayId)
+            continue;
+
+        JValue apps = pbnjson::Array();
+        for (const auto& recent : display.second.recents) {
+            JValue app = pbnjson::Object();
+            app.put("appId", recent.appId);
+            app.put("launchPointId", recent.launchPointId);
+            apps.append(app);
+        }
+
+        JValue item = pbnjson::Object();
+        item.put("displayId", display.first);
+        item.put("apps", apps);
+        json.append(item);
+    }
+}
+
+void RecentList::load()
+{
+    if (!File::isFile(m_path))
+        return;
+
+    JValue recents = JDomParser::fromString(File::readFile(m_path));
+    if (!recents.isArray()) {
+        Logger::warning(getClassName(), __FUNCTION__, m_path, "Invalid recents file");
+        return;
+    }
+
+    int count = 0;
+    for (JValue item : recents.items()) {
+        int displayId = 0;
+        JValue apps;
+        if (!JValueUtil::getValue(item, "displayId", displayId) || !JValueUtil::getValue(item, "apps", apps) || !apps.isArray())
+            continue;
+
+        Display& display = m_displays[displayId];
+        for (JValue app : apps.items()) {
+            Recent recent;
+            if (!JValueUtil::getValue(app, "appId", recent.appId) || recent.appId.empty())
+                continue;
+            JValueUtil::getValue(app, "launchPointId", recent.launchPointId);
+
+            Symbol appSymbol = SymbolTable::getInstance().intern(recent.appId);
+            if (display.index.find(appSymbol) != display.index.end() || (int) display.recents.size() >= MAX_RECENTS)
+                continue;
+            display.recents.push_back(std::move(recent));
+            display.index[appSymbol] = prev(display.recents.end());
+            count++;
+        }
+    }
+    Logger::info(getClassName(), __FUNCTION__, m_path, Logger::format("recents(%d)", count));
+}
+
+void RecentList::save()
+{
+    if (m_path.empty())
+        return;
+
+    JValue recents = pbnjson::Array();
+    toJson(recents);
+
+    string tmpPath = m_path + ".tmp";
+    if (!File::writeFile(tmpPath, recents.stringify()) || rename(tmpPath.c_str(), m_path.c_str()) != 0) {
+        Logger::warning(getClassName(), __FUNCTION__, m_path, "Failed to save recents");
+        File::deleteFile(tmpPath);
+    }
+}
+
+void RecentList::erase(int displayId, Display& display, list<Recent>::iterator it)
+{
+    Recent recent = std::move(*it);
+    display.index.erase(SymbolTable::getInstance().find(recent.appId));
+    display.recents.erase(it);
+    notify("removed", displayId, recent);
+}
+
+void RecentList::notify(const char* change, int displayId, const Recent& recent)
+{
+    JValue delta = pbnjson::Object();
+    delta.put("change", change);
+    delta.put("displayId", displayId);
+    delta.put("appId", recent.appId);
+    if (!recent.launchPointId.empty())
+        delta.put("launchPointId", recent.launchPointId);
+    LSM::getInstance().EventRecentsAppListChanged(delta);
+}
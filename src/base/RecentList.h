@@ -0,0 +1,85 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BASE_RECENTLIST_H_
+#define BASE_RECENTLIST_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <pbnjson.hpp>
+
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+#include "util/SymbolTable.h"
+#include "util/TimerWheel.h"
+
+using namespace std;
+using namespace pbnjson;
+
+// RecentList keeps apps in most recently foregrounded order per display.
+// Both moving to front and removing are O(1). Each change is notified with
+// LSM::EventRecentsAppListChanged as a delta. The list is saved on disk,
+// so it is available right after SAM is respawned.
+class RecentList : public ISingleton<RecentList>,
+                   public IClassName {
+friend class ISingleton<RecentList>;
+public:
+    virtual ~RecentList();
+
+    void initialize();
+    void finalize();
+
+    void moveToFront(int displayId, const string& appId, const string& launchPointId);
+    void removeByAppId(const string& appId);
+    // removes apps which are not installed anymore
+    void prune();
+
+    // negative displayId means all displays
+    void toJson(JValue& json, int displayId = -1);
+
+private:
+    static const int MAX_RECENTS = 32;
+    static const guint SAVE_DELAY = 1000; // 1 second
+
+    struct Recent {
+        string appId;
+        string launchPointId;
+    };
+
+    struct Display {
+        list<Recent> recents;
+        // appId symbol => position in recents
+        unordered_map<Symbol, list<Recent>::iterator> index;
+    };
+
+    static gboolean onSaveTimer(gpointer data);
+
+    RecentList();
+
+    void load();
+    void save();
+    void erase(int displayId, Display& display, list<Recent>::iterator it);
+    void notify(const char* change, int displayId, const Recent& recent);
+
+    map<int, Display> m_displays;
+
+    string m_path;
+    WheelTimer m_saveTimer;
+};
+
+#endif /* BASE_RECENTLIST_H_ */
@@ -16,6 +16,8 @@
 
 #include "RunningApp.h"
 
+#include "base/RecentList.h"
+#include "base/RunningAppList.h"
 #include "bus/client/AbsLifeHandler.h"
 #include "bus/service/ApplicationManager.h"
 #include "conf/SAMConf.h"
@@ -123,13 +125,15 @@ int RunningApp::getDisplayId(const string& instanceId)
 
 RunningApp::RunningApp(LaunchPointPtr launchPoint)
     : m_launchPoint(std::move(launchPoint)),
+      m_isDevmodeApp(m_launchPoint->getAppDesc()->isDevmodeApp()),
       m_instanceId(""),
       m_displayId(-1),
+      m_runningSnapshotPid(-1),
       m_webprocessid(""),
       m_isFullWindow(true),
       m_lifeStatus(LifeStatus::LifeStatus_STOP),
       m_isFirstLaunch(true),
-      m_killingTimer(0),
+      m_killingTimer(onKillingTimer, this),
       m_keepAlive(false),
       m_noSplash(true),
       m_spinner(true),
@@ -172,6 +176,65 @@ void RunningApp::registerApp(LunaTaskPtr lunaTask)
     Logger::info(CLASS_NAME, __FUNCTION__, m_instanceId, "Application is registered");
 }
 
+void RunningApp::setLaunchPoint(LaunchPointPtr launchPoint)
+{
+    m_launchPoint = std::move(launchPoint);
+    onLaunchPointChanged();
+}
+
+void RunningApp::onLaunchPointChanged()
+{
+    bool prev = m_isDevmodeApp;
+    m_isDevmodeApp = m_launchPoint->getAppDesc()->isDevmodeApp();
+    m_runningSnapshot.clear();
+    RunningAppList::getInstance().onLaunchPointChanged(*this, prev);
+}
+
+void RunningApp::setLS2Name(const string& name)
+{
+    string prev = m_ls2name;
+    m_ls2name = name;
+    RunningAppList::getInstance().onLS2NameChanged(*this, prev);
+}
+
+void RunningApp::setProcessId(pid_t pid)
+{
+    pid_t prev = m_nativePocess.getPid();
+    m_nativePocess.setPid(pid);
+    m_runningSnapshot.clear();
+    RunningAppList::getInstance().onProcessIdChanged(*this, prev);
+}
+
+void RunningApp::setWebprocid(const string& webprocid)
+{
+    string prev = m_webprocessid;
+    m_webprocessid = webprocid;
+    m_runningSnapshot.clear();
+    RunningAppList::getInstance().onWebprocessidChanged(*this, prev);
+}
+
+void RunningApp::setDisplayId(const int displayId)
+{
+    int prev = m_displayId;
+    // TODO This is temp solution for support all platforms.
+    if (displayId < 0)
+        m_displayId = 0;
+    else
+        m_displayId = displayId;
+
+    if (prev != m_displayId) {
+        m_runningSnapshot.clear();
+        RunningAppList::getInstance().onRunningChanged(*this);
+    }
+}
+
+void RunningApp::setToken(LSMessageToken token)
+{
+    LSMessageToken prev = m_token;
+    m_token = token;
+    RunningAppList::getInstance().onTokenChanged(*this, prev);
+}
+
 bool RunningApp::sendEvent(JValue& responsePayload)
 {
     if (!m_isRegistered) {
@@ -190,6 +253,7 @@ void RunningApp::setLifeStatus(LifeStatus lifeStatus)
     if (m_lifeStatus == lifeStatus) {
         return;
     }
+    LifeStatus prev = m_lifeStatus;
 
     // CLOSING is special transition. It should be allowed all cases
     if (isTransition(m_lifeStatus) && isTransition(lifeStatus) && lifeStatus != LifeStatus::LifeStatus_CLOSING) {
@@ -252,6 +316,9 @@ void RunningApp::setLifeStatus(LifeStatus lifeStatus)
     } else {
         stopKillingTimer();
     }
+    RunningAppList::getInstance().onLifeStatusChanged(*this, prev);
+    if (m_lifeStatus == LifeStatus::LifeStatus_FOREGROUND)
+        RecentList::getInstance().moveToFront(m_displayId, getAppId(), getLaunchPointId());
 
     ApplicationManager::getInstance().postGetAppLifeStatus(*this);
     ApplicationManager::getInstance().postGetAppLifeEvents(*this);
@@ -277,14 +344,11 @@ gboolean RunningApp::onKillingTimer(gpointer context)
 
 void RunningApp::startKillingTimer(guint timeout)
 {
-    stopKillingTimer();
-    m_killingTimer = g_timeout_add(timeout, onKillingTimer, this);
+    // Many apps can be closed at once. Their timers share one GSource in TimerWheel
+    m_killingTimer.start(timeout);
 }
 
 void RunningApp::stopKillingTimer()
 {
-    if (m_killingTimer > 0) {
-        g_source_remove(m_killingTimer);
-        m_killingTimer = 0;
-    }
+    m_killingTimer.stop();
 }
@@ -28,6 +28,7 @@
 #include "conf/SAMConf.h"
 #include "util/Logger.h"
 #include "util/Time.h"
+#include "util/TimerWheel.h"
 #include "util/NativeProcess.h"
 
 //                  < RunningApp LIFECYCLES >
@@ -73,12 +74,17 @@ public:
 
     bool sendEvent(JValue& payload);
 
-    string getAppId() const
+    const string& getAppId() const
     {
-        return m_launchPoint->getAppDesc()->getAppId();
+        return m_launchPoint->getAppId();
     }
 
-    string getLaunchPointId() const
+    Symbol getAppSymbol() const
+    {
+        return m_launchPoint->getAppSymbol();
+    }
+
+    const string& getLaunchPointId() const
     {
         return m_launchPoint->getLaunchPointId();
     }
@@ -96,24 +102,27 @@ public:
         } else {
             m_instanceId = instanceId;
         }
+        m_runningSnapshot.clear();
     }
 
     const string& getLS2Name() const
     {
         return m_ls2name;
     }
-    void setLS2Name(const string& name)
-    {
-        m_ls2name = name;
-    }
+    void setLS2Name(const string& name);
 
     LaunchPointPtr getLaunchPoint() const
     {
         return m_launchPoint;
     }
-    void setLaunchPoint(LaunchPointPtr launchPoint)
+    void setLaunchPoint(LaunchPointPtr launchPoint);
+    // Called when the launch point is changed or its AppDescription is replaced
+    void onLaunchPointChanged();
+
+    // It is decided when the launch point is set. Counters in RunningAppList depend on it
+    bool isDevmodeApp() const
     {
-        m_launchPoint = std::move(launchPoint);
+        return m_isDevmodeApp;
     }
 
     const string& getWindowId() const
@@ -129,14 +138,7 @@ public:
     {
         return m_displayId;
     }
-    void setDisplayId(const int displayId)
-    {
-        // TODO This is temp solution for support all platforms.
-        if (displayId < 0)
-            m_displayId = 0;
-        else
-            m_displayId = displayId;
-    }
+    void setDisplayId(const int displayId);
 
     bool isFullWindow() const
     {
@@ -151,19 +153,13 @@ public:
     {
         return m_nativePocess.getPid();
     }
-    void setProcessId(pid_t pid)
-    {
-        m_nativePocess.setPid(pid);
-    }
+    void setProcessId(pid_t pid);
 
     const string& getWebprocessid() const
     {
         return m_webprocessid;
     }
-    void setWebprocid(const string& webprocid)
-    {
-        m_webprocessid = webprocid;
-    }
+    void setWebprocid(const string& webprocid);
 
     bool isRegistered()
     {
@@ -178,7 +174,7 @@ public:
     }
     void setLifeStatus(LifeStatus lifeStatus);
 
-    bool isTransition()
+    bool isTransition() const
     {
         return RunningApp::isTransition(m_lifeStatus);
     }
@@ -250,10 +246,7 @@ public:
     {
         return m_token;
     }
-    void setToken(LSMessageToken token)
-    {
-        m_token = token;
-    }
+    void setToken(LSMessageToken token);
 
     int getContext() const
     {
@@ -279,6 +272,19 @@ public:
         json.put("reason", lunaTask->getReason());
     }
 
+    // serialized 'running' item. It is reused until its values are changed
+    // pid is compared as well because NativeProcess owns it and can be changed without RunningApp
+    const string& getRunningSnapshot()
+    {
+        if (m_runningSnapshot.empty() || m_runningSnapshotPid != m_nativePocess.getPid()) {
+            m_runningSnapshotPid = m_nativePocess.getPid();
+            JValue json = pbnjson::Object();
+            toAPIJson(json, true);
+            m_runningSnapshot = json.stringify();
+        }
+        return m_runningSnapshot;
+    }
+
     void toAPIJson(JValue& json, bool isRunningList)
     {
         json.put("instanceId", m_instanceId);
@@ -318,9 +324,12 @@ private:
     void stopKillingTimer();
 
     LaunchPointPtr m_launchPoint;
+    bool m_isDevmodeApp;
 
     string m_instanceId;
     int m_displayId;
+    string m_runningSnapshot;
+    pid_t m_runningSnapshotPid;
 
     string m_webprocessid;
     string m_windowId;
@@ -329,7 +338,7 @@ private:
     LifeStatus m_lifeStatus;
     bool m_isFirstLaunch;
     long long m_startTime;
-    guint m_killingTimer;
+    WheelTimer m_killingTimer;
 
     // initial parameter
     string m_preload;
@@ -19,7 +19,29 @@
 #include "bus/service/ApplicationManager.h"
 #include "conf/RuntimeInfo.h"
 
+template <typename T>
+static void insertIndex(unordered_map<T, set<string>>& index, const T& key, const string& instanceId)
+{
+    index[key].insert(instanceId);
+}
+
+template <typename T>
+static void eraseIndex(unordered_map<T, set<string>>& index, const T& key, const string& instanceId)
+{
+    auto it = index.find(key);
+    if (it == index.end())
+        return;
+    it->second.erase(instanceId);
+    if (it->second.empty())
+        index.erase(it);
+}
+
 RunningAppList::RunningAppList()
+    : m_transitionCount(0),
+      m_devmodeTransitionCount(0),
+      m_version(1),
+      m_devmodeVersion(1),
+      m_snapshotVersion(0)
 {
     setClassName("RunningAppList");
 }
@@ -178,55 +200,39 @@ RunningAppPtr RunningAppList::getByInstanceId(const string& instanceId)
 
 RunningAppPtr RunningAppList::getByAppId(const string& appId, const int displayId)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getAppId() == appId) {
-            if (displayId == -1)
-                return it->second;
-            if ((*it).second->getDisplayId() == displayId)
-                return it->second;
-        }
+    auto it = m_appIdIndex.find(SymbolTable::getInstance().find(appId));
+    if (it == m_appIdIndex.end())
+        return nullptr;
+
+    // Only instances of the app are checked. (one per display normally)
+    for (const auto& instanceId : it->second) {
+        auto app = m_map.find(instanceId);
+        if (app == m_map.end())
+            continue;
+        if (displayId == -1 || app->second->getDisplayId() == displayId)
+            return app->second;
     }
     return nullptr;
 }
 
 RunningAppPtr RunningAppList::getByToken(const LSMessageToken& token)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getToken() == token) {
-            return it->second;
-        }
-    }
-    return nullptr;
+    return findIndex(m_tokenIndex, token);
 }
 
 RunningAppPtr RunningAppList::getByLS2Name(const string& ls2name)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getLS2Name() == ls2name) {
-            return it->second;
-        }
-    }
-    return nullptr;
+    return findIndex(m_ls2nameIndex, ls2name);
 }
 
 RunningAppPtr RunningAppList::getByPid(const pid_t pid)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getProcessId() == pid) {
-            return it->second;
-        }
-    }
-    return nullptr;
+    return findIndex(m_pidIndex, pid);
 }
 
 RunningAppPtr RunningAppList::getByWebprocessid(const string& webprocessid)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getWebprocessid() == webprocessid) {
-            return it->second;
-        }
-    }
-    return nullptr;
+    return findIndex(m_webprocessidIndex, webprocessid);
 }
 
 bool RunningAppList::add(RunningAppPtr runningApp)
@@ -242,6 +248,7 @@ bool RunningAppList::add(RunningAppPtr runningApp)
         return false;
     }
     m_map[runningApp->getInstanceId()] = runningApp;
+    addIndexes(*runningApp);
     onAdd(std::move(runningApp));
     return true;
 }
@@ -251,38 +258,32 @@ void RunningAppList::removeByObject(RunningAppPtr runningApp)
     if (runningApp == nullptr)
         return;
 
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second == runningApp) {
-            RunningAppPtr ptr = it->second;
-            m_map.erase(it);
-            onRemove(std::move(ptr));
-            return;
-        }
-    }
+    auto it = m_map.find(runningApp->getInstanceId());
+    if (it == m_map.end() || it->second != runningApp)
+        return;
+    m_map.erase(it);
+    onRemove(std::move(runningApp));
 }
 
 void RunningAppList::removeByInstanceId(const string& instanceId)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getInstanceId() == instanceId) {
-            RunningAppPtr ptr = it->second;
-            m_map.erase(it);
-            onRemove(std::move(ptr));
-            return;
-        }
-    }
+    auto it = m_map.find(instanceId);
+    if (it == m_map.end())
+        return;
+
+    RunningAppPtr ptr = it->second;
+    m_map.erase(it);
+    onRemove(std::move(ptr));
 }
 
 void RunningAppList::removeByPid(const pid_t pid)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if ((*it).second->getProcessId() == pid) {
-            RunningAppPtr ptr = it->second;
-            m_map.erase(it);
-            onRemove(std::move(ptr));
-            return;
-        }
-    }
+    RunningAppPtr ptr = getByPid(pid);
+    if (ptr == nullptr)
+        return;
+
+    m_map.erase(ptr->getInstanceId());
+    onRemove(std::move(ptr));
 }
 
 void RunningAppList::removeAllByType(AppType type)
@@ -328,6 +329,19 @@ void RunningAppList::removeAllByLaunchPoint(LaunchPointPtr launchPoint)
     }
 }
 
+void RunningAppList::updateAllByLaunchPoint(LaunchPointPtr launchPoint)
+{
+    auto it = m_appIdIndex.find(launchPoint->getAppSymbol());
+    if (it == m_appIdIndex.end())
+        return;
+
+    for (const string& instanceId : it->second) {
+        RunningAppPtr runningApp = m_map[instanceId];
+        if (runningApp->getLaunchPoint() == launchPoint)
+            runningApp->onLaunchPointChanged();
+    }
+}
+
 bool RunningAppList::setConext(AppType type, const int context)
 {
     for (auto it = m_map.begin(); it != m_map.end(); ++it) {
@@ -340,15 +354,9 @@ bool RunningAppList::setConext(AppType type, const int context)
 
 bool RunningAppList::isTransition(bool devmodeOnly)
 {
-    for (auto it = m_map.begin(); it != m_map.end(); ++it) {
-        if (devmodeOnly) {
-            if ((*it).second->getLaunchPoint()->getAppDesc()->isDevmodeApp() &&
-                (*it).second->isTransition()) return true;
-        } else {
-            if ((*it).second->isTransition()) return true;
-        }
-    }
-    return false;
+    if (devmodeOnly)
+        return m_devmodeTransitionCount > 0;
+    return m_transitionCount > 0;
 }
 
 void RunningAppList::toJson(JValue& array, bool devmodeOnly)
@@ -367,6 +375,34 @@ void RunningAppList::toJson(JValue& array, bool devmodeOnly)
     }
 }
 
+shared_ptr<const string> RunningAppList::getSharedSnapshot(bool devmodeOnly)
+{
+    if (m_snapshot && m_snapshotVersion == m_version)
+        return devmodeOnly ? m_devmodeSnapshot : m_snapshot;
+
+    // each app is serialized only when it is changed. Only concatenation is needed here
+    string snapshot = "[";
+    string devmodeSnapshot = "[";
+    for (const auto& runningApp : m_map) {
+        const string& item = runningApp.second->getRunningSnapshot();
+        if (snapshot.size() > 1)
+            snapshot += ",";
+        snapshot += item;
+
+        if (!runningApp.second->isDevmodeApp())
+            continue;
+        if (devmodeSnapshot.size() > 1)
+            devmodeSnapshot += ",";
+        devmodeSnapshot += item;
+    }
+    snapshot += "]";
+    devmodeSnapshot += "]";
+    m_snapshot = make_shared<const string>(std::move(snapshot));
+    m_devmodeSnapshot = make_shared<const string>(std::move(devmodeSnapshot));
+    m_snapshotVersion = m_version;
+    return devmodeOnly ? m_devmodeSnapshot : m_snapshot;
+}
+
 void RunningAppList::onAdd(RunningAppPtr runningApp)
 {
     // Status should be defined before calling this method
@@ -376,7 +412,135 @@ void RunningAppList::onAdd(RunningAppPtr runningApp)
 
 void RunningAppList::onRemove(RunningAppPtr runningApp)
 {
+    // Indexes should be removed after the app is erased in m_map
+    removeIndexes(*runningApp);
     Logger::info(getClassName(), __FUNCTION__, runningApp->getInstanceId() + " is removed");
     runningApp->setLifeStatus(LifeStatus::LifeStatus_STOP);
     ApplicationManager::getInstance().postRunning(std::move(runningApp));
 }
+
+void RunningAppList::onLS2NameChanged(const RunningApp& runningApp, const string& prev)
+{
+    if (!isListed(runningApp))
+        return;
+    eraseIndex(m_ls2nameIndex, prev, runningApp.getInstanceId());
+    insertIndex(m_ls2nameIndex, runningApp.getLS2Name(), runningApp.getInstanceId());
+}
+
+void RunningAppList::onProcessIdChanged(const RunningApp& runningApp, pid_t prev)
+{
+    if (!isListed(runningApp))
+        return;
+    eraseIndex(m_pidIndex, prev, runningApp.getInstanceId());
+    insertIndex(m_pidIndex, runningApp.getProcessId(), runningApp.getInstanceId());
+    onRunningChanged(runningApp);
+}
+
+void RunningAppList::onWebprocessidChanged(const RunningApp& runningApp, const string& prev)
+{
+    if (!isListed(runningApp))
+        return;
+    eraseIndex(m_webprocessidIndex, prev, runningApp.getInstanceId());
+    insertIndex(m_webprocessidIndex, runningApp.getWebprocessid(), runningApp.getInstanceId());
+    onRunningChanged(runningApp);
+}
+
+void RunningAppList::onTokenChanged(const RunningApp& runningApp, LSMessageToken prev)
+{
+    if (!isListed(runningApp))
+        return;
+    eraseIndex(m_tokenIndex, prev, runningApp.getInstanceId());
+    insertIndex(m_tokenIndex, runningApp.getToken(), runningApp.getInstanceId());
+}
+
+void RunningAppList::onLifeStatusChanged(const RunningApp& runningApp, LifeStatus prev)
+{
+    if (!isListed(runningApp))
+        return;
+
+    int delta = (runningApp.isTransition() ? 1 : 0) - (RunningApp::isTransition(prev) ? 1 : 0);
+    m_transitionCount += delta;
+    if (runningApp.isDevmodeApp())
+        m_devmodeTransitionCount += delta;
+}
+
+void RunningAppList::onRunningChanged(const RunningApp& runningApp)
+{
+    if (!isListed(runningApp))
+        return;
+
+    m_version++;
+    if (runningApp.isDevmodeApp())
+        m_devmodeVersion++;
+}
+
+void RunningAppList::onLaunchPointChanged(const RunningApp& runningApp, bool prevDevmode)
+{
+    if (!isListed(runningApp))
+        return;
+
+    if (runningApp.isTransition())
+        m_devmodeTransitionCount += (runningApp.isDevmodeApp() ? 1 : 0) - (prevDevmode ? 1 : 0);
+    m_version++;
+    m_devmodeVersion++;
+}
+
+bool RunningAppList::isListed(const RunningApp& runningApp)
+{
+    // Indexes are changed only for the apps in the list
+    auto it = m_map.find(runningApp.getInstanceId());
+    return it != m_map.end() && it->second.get() == &runningApp;
+}
+
+void RunningAppList::addIndexes(const RunningApp& runningApp)
+{
+    const string& instanceId = runningApp.getInstanceId();
+    bool isDevmodeApp = runningApp.isDevmodeApp();
+    if (runningApp.isTransition()) {
+        m_transitionCount++;
+        if (isDevmodeApp)
+            m_devmodeTransitionCount++;
+    }
+    m_version++;
+    if (isDevmodeApp)
+        m_devmodeVersion++;
+
+    insertIndex(m_appIdIndex, runningApp.getAppSymbol(), instanceId);
+    insertIndex(m_tokenIndex, runningApp.getToken(), instanceId);
+    insertIndex(m_pidIndex, runningApp.getProcessId(), instanceId);
+    insertIndex(m_ls2nameIndex, runningApp.getLS2Name(), instanceId);
+    insertIndex(m_webprocessidIndex, runningApp.getWebprocessid(), instanceId);
+}
+
+void RunningAppList::removeIndexes(const RunningApp& runningApp)
+{
+    const string& instanceId = runningApp.getInstanceId();
+    bool isDevmodeApp = runningApp.isDevmodeApp();
+    if (runningApp.isTransition()) {
+        m_transitionCount--;
+        if (isDevmodeApp)
+            m_devmodeTransitionCount--;
+    }
+    m_version++;
+    if (isDevmodeApp)
+        m_devmodeVersion++;
+
+    eraseIndex(m_appIdIndex, runningApp.getAppSymbol(), instanceId);
+    eraseIndex(m_tokenIndex, runningApp.getToken(), instanceId);
+    eraseIndex(m_pidIndex, runningApp.getProcessId(), instanceId);
+    eraseIndex(m_ls2nameIndex, runningApp.getLS2Name(), instanceId);
+    eraseIndex(m_webprocessidIndex, runningApp.getWebprocessid(), instanceId);
+}
+
+template <typename T>
+RunningAppPtr RunningAppList::findIndex(const Index<T>& index, const T& key)
+{
+    auto it = index.find(key);
+    if (it == index.end() || it->second.empty())
+        return nullptr;
+
+    auto app = m_map.find(*it->second.begin());
+    if (app == m_map.end())
+        return nullptr;
+    return app->second;
+}
@@ -20,6 +20,8 @@
 #include <iostream>
 #include <memory>
 #include <map>
+#include <set>
+#include <unordered_map>
 
 #include "interface/ISingleton.h"
 #include "interface/IClassName.h"
@@ -30,6 +32,7 @@ using namespace std;
 class RunningAppList : public ISingleton<RunningAppList>,
                        public IClassName {
 friend class ISingleton<RunningAppList>;
+friend class RunningApp;
 public:
     virtual ~RunningAppList();
 
@@ -55,18 +58,69 @@ public:
     void removeAllByType(AppType type);
     void removeAllByConext(AppType type, const int context);
     void removeAllByLaunchPoint(LaunchPointPtr launchPoint);
+    // running items of the launch point are serialized again. ex) AppDescription is replaced
+    void updateAllByLaunchPoint(LaunchPointPtr launchPoint);
 
     bool setConext(AppType type, const int context);
     bool isTransition(bool devmodeOnly);
     void toJson(JValue& array, bool devmodeOnly = false);
 
+    // increased whenever 'running' items are changed
+    unsigned long getVersion(bool devmodeOnly = false) const
+    {
+        return devmodeOnly ? m_devmodeVersion : m_version;
+    }
+
+    // serialized 'running' array. It is concatenated again only after the list is changed
+    const string& getSnapshot(bool devmodeOnly = false)
+    {
+        return *getSharedSnapshot(devmodeOnly);
+    }
+    shared_ptr<const string> getSharedSnapshot(bool devmodeOnly = false);
+
 private:
+    // key => instanceIds. instanceIds are sorted like m_map
+    template <typename T>
+    using Index = unordered_map<T, set<string>>;
+
     void onAdd(RunningAppPtr runningApp);
     void onRemove(RunningAppPtr runningApp);
 
+    // Called by RunningApp when indexed value is changed
+    void onLS2NameChanged(const RunningApp& runningApp, const string& prev);
+    void onProcessIdChanged(const RunningApp& runningApp, pid_t prev);
+    void onWebprocessidChanged(const RunningApp& runningApp, const string& prev);
+    void onTokenChanged(const RunningApp& runningApp, LSMessageToken prev);
+    void onLifeStatusChanged(const RunningApp& runningApp, LifeStatus prev);
+    void onRunningChanged(const RunningApp& runningApp);
+    void onLaunchPointChanged(const RunningApp& runningApp, bool prevDevmode);
+
     RunningAppList();
 
+    bool isListed(const RunningApp& runningApp);
+    void addIndexes(const RunningApp& runningApp);
+    void removeIndexes(const RunningApp& runningApp);
+
+    template <typename T>
+    RunningAppPtr findIndex(const Index<T>& index, const T& key);
+
     map<string, RunningAppPtr> m_map;
+
+    Index<Symbol> m_appIdIndex;
+    Index<LSMessageToken> m_tokenIndex;
+    Index<pid_t> m_pidIndex;
+    Index<string> m_ls2nameIndex;
+    Index<string> m_webprocessidIndex;
+
+    // number of apps in transition
+    int m_transitionCount;
+    int m_devmodeTransitionCount;
+
+    unsigned long m_version;
+    unsigned long m_devmodeVersion;
+    unsigned long m_snapshotVersion;
+    shared_ptr<const string> m_snapshot;
+    shared_ptr<const string> m_devmodeSnapshot;
 };
 
 #endif /* BASE_RUNNINGAPPLIST_H_ */
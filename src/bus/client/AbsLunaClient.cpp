@@ -16,6 +16,8 @@
 
 #include "AbsLunaClient.h"
 
+#include "util/BootTimeline.h"
+
 JValue& AbsLunaClient::getEmptyPayload()
 {
     static JValue empty;
@@ -56,6 +58,8 @@ bool AbsLunaClient::_onServerStatus(LSHandle* sh, LSMessage* message, void* cont
     else
         Logger::info(client->getClassName(), __FUNCTION__, "Service is down");
 
+    if (connected)
+        BootTimeline::getInstance().mark("connected:" + client->getName());
     client->m_serverStatusCount++;
     client->m_isConnected = connected;
     client->EventServiceStatusChanged(connected);
@@ -16,9 +16,11 @@
 
 #include "DB8.h"
 
+#include "base/AppDescriptionList.h"
 #include "base/LaunchPointList.h"
 #include "bus/service/ApplicationManager.h"
 #include "conf/SAMConf.h"
+#include "util/BootTimeline.h"
 #include "util/JValueUtil.h"
 #include "util/Logger.h"
 
@@ -140,7 +142,8 @@ void DB8::deleteLaunchPoint(const string& launchPointId)
 
 void DB8::onInitialzed()
 {
-    // nothing
+    // launchPoints should be synced before other listeners use them
+    AppDescriptionList::getInstance().EventFullyScanned.connect(boost::bind(&DB8::onFullyScanned, this), boost::signals2::at_front);
 }
 
 void DB8::onFinalized()
@@ -181,7 +184,20 @@ bool DB8::onFind(LSHandle* sh, LSMessage* message, void* context)
         getInstance().putKind();
         return true;
     }
-    Logger::info(getInstance().getClassName(), __FUNCTION__, "Start to sync DB8");
+    // In staged scanning, apps which are not scanned yet look like uninstalled apps.
+    if (!AppDescriptionList::getInstance().isFullyScanned()) {
+        Logger::info(getInstance().getClassName(), __FUNCTION__, "Wait for scanning all applications");
+        getInstance().m_pendingResults = results;
+        return true;
+    }
+    getInstance().sync(results);
+    return true;
+}
+
+void DB8::sync(const JValue& results)
+{
+    Logger::info(getClassName(), __FUNCTION__, "Start to sync DB8");
+    BootTimeline::getInstance().begin("DB8:sync");
 
     string appId;
     string launchPointId;
@@ -193,25 +209,29 @@ bool DB8::onFind(LSHandle* sh, LSMessage* message, void* context)
         if (!JValueUtil::getValue(results[i], "id", appId) ||
             !JValueUtil::getValue(results[i], "launchPointId", launchPointId) ||
             !JValueUtil::getValue(results[i], "type", type)) {
-            Logger::warning(getInstance().getClassName(), __FUNCTION__, "Invalid data in DB8");
+            Logger::warning(getClassName(), __FUNCTION__, "Invalid data in DB8");
             continue;
         }
 
         if (appId.empty() || type.empty()) {
-            DB8::getInstance().deleteLaunchPoint(launchPointId);
+            deleteLaunchPoint(launchPointId);
             continue;
         }
 
         appDesc = AppDescriptionList::getInstance().getByAppId(appId);
         if (appDesc == nullptr) {
-            Logger::warning(getInstance().getClassName(), __FUNCTION__, "The app is already uninstalled");
-            DB8::getInstance().deleteLaunchPoint(launchPointId);
+            Logger::warning(getClassName(), __FUNCTION__, "The app is already uninstalled");
+            deleteLaunchPoint(launchPointId);
             continue;
         }
 
         launchPoint = LaunchPointList::getInstance().getByLaunchPointId(launchPointId);
         if (type == "default") {
+            if (launchPoint == nullptr)
+                continue;
             launchPoint->setDatabase(results[i]);
+            // title in DB can be different from appinfo.json
+            LaunchPointList::getInstance().reorder(launchPoint);
         } else if (type == "bookmark") {
             if (launchPoint == nullptr) {
                 launchPoint = LaunchPointList::getInstance().createBootmarkByDB(appDesc, results[i]);
@@ -219,10 +239,19 @@ bool DB8::onFind(LSHandle* sh, LSMessage* message, void* context)
             }
         }
     }
-    Logger::info(getInstance().getClassName(), __FUNCTION__, "Complete to sync DB8");
+    Logger::info(getClassName(), __FUNCTION__, "Complete to sync DB8");
+    BootTimeline::getInstance().end("DB8:sync");
+    ApplicationManager::getInstance().scheduleSnapshots();
+}
 
-    // 여기서 LaunchPoints를 만들어 넣어야 함.
-    return true;
+void DB8::onFullyScanned()
+{
+    if (m_pendingResults.isNull())
+        return;
+
+    JValue results = m_pendingResults;
+    m_pendingResults = JValue();
+    sync(results);
 }
 
 void DB8::find()
@@ -50,6 +50,8 @@ private:
 
     static bool onFind(LSHandle* sh, LSMessage* message, void* context);
     void find();
+    void sync(const JValue& results);
+    void onFullyScanned();
 
     static bool onPutKind(LSHandle* sh, LSMessage* message, void* context);
     void putKind();
@@ -59,6 +61,9 @@ private:
 
     DB8();
 
+    // 'find' results which are received before all apps are scanned
+    JValue m_pendingResults;
+
 };
 
 #endif /* BUS_CLIENT_DB8_H_ */
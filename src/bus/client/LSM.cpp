@@ -19,6 +19,7 @@
 #include "base/AppDescription.h"
 #include "base/LaunchPointList.h"
 #include "base/LaunchPoint.h"
+#include "base/RecentList.h"
 #include "base/RunningApp.h"
 #include "base/RunningAppList.h"
 #include "bus/service/ApplicationManager.h"
@@ -132,6 +133,9 @@ bool LSM::onGetForegroundAppInfo(LSHandle* sh, LSMessage* message, void* context
             runningApp->setProcessId(atoi(processId.c_str()));
         }
         runningApp->setLifeStatus(LifeStatus::LifeStatus_FOREGROUND);
+        // fullscreen app comes to front again when overlay apps are closed
+        if (newFullWindowAppId == appId)
+            RecentList::getInstance().moveToFront(runningApp->getDisplayId(), appId, runningApp->getLaunchPointId());
         if (runningApp->isFirstLaunch())
             Logger::info(getInstance().getClassName(), __FUNCTION__, runningApp->getAppId(), Logger::format("Foreground Time: %lld ms", runningApp->getTimeStamp()));
         newForegroundAppInfo.append(orgForegroundAppInfo[i].duplicate());
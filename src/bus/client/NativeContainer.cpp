@@ -201,12 +201,18 @@ void NativeContainer::launch(RunningAppPtr runningApp, LunaTaskPtr lunaTask)
 
     runningApp->setLifeStatus(LifeStatus::LifeStatus_LAUNCHING);
 
-    if (!runningApp->getLinuxProcess().run()) {
+    GPid pid = -1;
+    if (!runningApp->getLinuxProcess().run(pid)) {
         RunningAppList::getInstance().removeByObject(runningApp);
         lunaTask->setErrCodeAndText(ErrCode_LAUNCH, "Failed to launch process");
         lunaTask->error(lunaTask);
         return;
     }
+    // The app was indexed with pid(-1) before spawning. onKillChildProcess finds it by the new pid
+    runningApp->setProcessId(pid);
+    if (RunningAppList::getInstance().getByPid(pid) != runningApp) {
+        Logger::error(getClassName(), __FUNCTION__, runningApp->getAppId(), Logger::format("Process(%d) is not indexed", pid));
+    }
 
     g_child_watch_add(runningApp->getLinuxProcess().getPid(), onKillChildProcess, nullptr);
     runningApp->getLinuxProcess().track();
@@ -189,10 +189,7 @@ void WAM::launch(RunningAppPtr runningApp, LunaTaskPtr lunaTask)
         return;
     }
 
-    JValue appDesc = pbnjson::Object();
-    runningApp->getLaunchPoint()->toJson(appDesc);
-
-    requestPayload.put("appDesc", appDesc);
+    requestPayload.put("appDesc", runningApp->getLaunchPoint()->getJson());
     requestPayload.put("appId", runningApp->getAppId());
     requestPayload.put("instanceId", runningApp->getInstanceId());
     requestPayload.put("reason", lunaTask->getReason());
@@ -16,10 +16,13 @@
 
 #include "ApplicationManager.h"
 
+#include <string.h>
 #include <string>
 #include <vector>
 
+#include "base/Catalog.h"
 #include "base/LunaTaskList.h"
+#include "base/RecentList.h"
 #include "base/LaunchPointList.h"
 #include "base/AppDescriptionList.h"
 #include "base/RunningAppList.h"
@@ -29,6 +32,7 @@
 #include "conf/SAMConf.h"
 #include "manager/PolicyManager.h"
 #include "SchemaChecker.h"
+#include "util/BootTimeline.h"
 #include "util/JValueUtil.h"
 #include "util/Time.h"
 
@@ -46,6 +50,7 @@ const char* ApplicationManager::METHOD_GET_FOREGROUND_APPINFO = "getForegroundAp
 const char* ApplicationManager::METHOD_LOCK_APP = "lockApp";
 const char* ApplicationManager::METHOD_REGISTER_APP = "registerApp";
 const char* ApplicationManager::METHOD_REGISTER_NATIVE_APP = "registerNativeApp";
+const char* ApplicationManager::METHOD_LIST_RECENTS = "listRecents";
 
 const char* ApplicationManager::METHOD_LIST_APPS = "listApps";
 const char* ApplicationManager::METHOD_GET_APP_STATUS = "getAppStatus";
@@ -71,6 +76,7 @@ LSMethod ApplicationManager::METHODS_ROOT[] = {
     { METHOD_LOCK_APP,                 ApplicationManager::onAPICalled, LUNA_METHOD_FLAGS_NONE },
     { METHOD_REGISTER_APP,             ApplicationManager::onAPICalled, LUNA_METHOD_FLAGS_NONE },
     { METHOD_REGISTER_NATIVE_APP,      ApplicationManager::onAPICalled, LUNA_METHOD_FLAGS_NONE },
+    { METHOD_LIST_RECENTS,             ApplicationManager::onAPICalled, LUNA_METHOD_FLAGS_NONE },
 
     // core: package
     { METHOD_LIST_APPS,                ApplicationManager::onAPICalled, LUNA_METHOD_FLAGS_NONE },
@@ -149,6 +155,11 @@ Done:
 ApplicationManager::ApplicationManager()
     : LS::Handle(LS::registerService("com.webos.applicationManager")),
       m_enableSubscription(false),
+      m_snapshotSource(0),
+      m_postedRunningVersion(0),
+      m_postedRunningDevVersion(0),
+      m_appsDeltaLog("AppsDeltaLog", DELTA_LOG_CAPACITY),
+      m_launchPointsDeltaLog("LaunchPointsDeltaLog", DELTA_LOG_CAPACITY),
       m_compat1("com.webos.service.applicationmanager"),
       m_compat2("com.webos.service.applicationManager")
 {
@@ -166,6 +177,7 @@ ApplicationManager::ApplicationManager()
     registerApiHandler(CATEGORY_ROOT, METHOD_LOCK_APP, boost::bind(&ApplicationManager::lockApp, this, boost::placeholders::_1));
     registerApiHandler(CATEGORY_ROOT, METHOD_REGISTER_APP, boost::bind(&ApplicationManager::registerApp, this, boost::placeholders::_1));
     registerApiHandler(CATEGORY_ROOT, METHOD_REGISTER_NATIVE_APP, boost::bind(&ApplicationManager::registerApp, this, boost::placeholders::_1));
+    registerApiHandler(CATEGORY_ROOT, METHOD_LIST_RECENTS, boost::bind(&ApplicationManager::listRecents, this, boost::placeholders::_1));
 
     registerApiHandler(CATEGORY_ROOT, METHOD_LIST_APPS, boost::bind(&ApplicationManager::listApps, this, boost::placeholders::_1));
     registerApiHandler(CATEGORY_ROOT, METHOD_GET_APP_STATUS, boost::bind(&ApplicationManager::getAppStatus, this, boost::placeholders::_1));
@@ -186,6 +198,8 @@ ApplicationManager::ApplicationManager()
 
 ApplicationManager::~ApplicationManager()
 {
+    if (m_snapshotSource > 0)
+        g_source_remove(m_snapshotSource);
 }
 
 bool ApplicationManager::attach(GMainLoop* gml)
@@ -244,6 +258,29 @@ void ApplicationManager::detach()
 
 void ApplicationManager::launch(LunaTaskPtr lunaTask)
 {
+    // In staged scanning, the app can be in the directory which is not scanned yet
+    if (!AppDescriptionList::getInstance().isFullyScanned() &&
+        (!lunaTask->getAppId().empty() || !lunaTask->getLaunchPointId().empty()) &&
+        LaunchPointList::getInstance().getByLunaTask(lunaTask) == nullptr) {
+        string appId = lunaTask->getAppId();
+        string suffix = "_default";
+        const string& launchPointId = lunaTask->getLaunchPointId();
+        if (appId.empty() && launchPointId.size() > suffix.size() &&
+            launchPointId.compare(launchPointId.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            appId = launchPointId.substr(0, launchPointId.size() - suffix.size());
+        }
+        if (!appId.empty() && !AppDescriptionList::getInstance().isExist(appId)) {
+            Logger::info(getClassName(), __FUNCTION__, appId, "Scan on demand");
+            AppDescriptionList::getInstance().scanApp(appId);
+        }
+        // bookmarks are restored from DB8 after all apps are scanned
+        if (LaunchPointList::getInstance().getByLunaTask(lunaTask) == nullptr) {
+            Logger::info(getClassName(), __FUNCTION__, lunaTask->getId(), "Wait for scanning all applications");
+            m_pendingLaunches.push_back(std::move(lunaTask));
+            return;
+        }
+    }
+
     LaunchPointPtr launchPoint = LaunchPointList::getInstance().getByLunaTask(lunaTask);
 
     // launchPoint can be nullptr because there can be only 'instanceId' in requestPayload
@@ -279,6 +316,15 @@ void ApplicationManager::launch(LunaTaskPtr lunaTask)
     PolicyManager::getInstance().launch(std::move(lunaTask));
 }
 
+void ApplicationManager::launchPendings()
+{
+    vector<LunaTaskPtr> pendingLaunches;
+    pendingLaunches.swap(m_pendingLaunches);
+    for (LunaTaskPtr& lunaTask : pendingLaunches) {
+        launch(std::move(lunaTask));
+    }
+}
+
 void ApplicationManager::pause(LunaTaskPtr lunaTask)
 {
     RunningAppPtr runningApp = RunningAppList::getInstance().getByLunaTask(lunaTask);
@@ -312,7 +358,9 @@ void ApplicationManager::running(LunaTaskPtr lunaTask)
 {
     bool subscribed = false;
 
-    makeRunning(lunaTask->getResponsePayload(), lunaTask->isDevmodeRequest());
+    CatalogSnapshotPtr snapshot = Catalog::getInstance().update(Catalog::CatalogPart_Running);
+    lunaTask->putSerializedResponse("running", lunaTask->isDevmodeRequest() ? snapshot->devmodeRunning : snapshot->running);
+    lunaTask->getResponsePayload().put("catalogGeneration", (int64_t) snapshot->generation);
     lunaTask->getResponsePayload().put("returnValue", true);
 
     if (lunaTask->getRequest().isSubscription()) {
@@ -444,23 +492,62 @@ void ApplicationManager::registerApp(LunaTaskPtr lunaTask)
     // You don't need to reply here
 }
 
+void ApplicationManager::listRecents(LunaTaskPtr lunaTask)
+{
+    int displayId = -1;
+    JValueUtil::getValue(lunaTask->getRequestPayload(), "displayId", displayId);
+
+    JValue recents = pbnjson::Array();
+    RecentList::getInstance().toJson(recents, displayId);
+    lunaTask->getResponsePayload().put("recents", recents);
+
+    // Only 'moveToFront' and 'removed' deltas are posted after this reply
+    if (lunaTask->getRequest().isSubscription())
+        lunaTask->getResponsePayload().put("subscribed", LSSubscriptionAdd(this->get(), toRecentsKey(displayId).c_str(), lunaTask->getMessage(), nullptr));
+    else
+        lunaTask->getResponsePayload().put("subscribed", false);
+    lunaTask->getResponsePayload().put("returnValue", true);
+    LunaTaskList::getInstance().removeAfterReply(std::move(lunaTask));
+}
+
 void ApplicationManager::listApps(LunaTaskPtr lunaTask)
 {
     pbnjson::JValue apps = pbnjson::Array();
     pbnjson::JValue properties = pbnjson::Array();
+    bool delta = false;
 
     if (JValueUtil::getValue(lunaTask->getRequestPayload(), "properties", properties) && properties.arraySize() > 0) {
         properties.append("id");
     }
 
+    JValueUtil::getValue(lunaTask->getRequestPayload(), "delta", delta);
+    if (delta && (!lunaTask->getRequest().isSubscription() || properties.arraySize() > 0)) {
+        lunaTask->setErrCodeAndText(ErrCode_INVALID_PAYLOAD, "delta mode requires subscription without properties");
+        LunaTaskList::getInstance().removeAfterReply(std::move(lunaTask));
+        return;
+    }
+
     // Don't reply 'apps' in listApps during initializaion
-    if (m_enableSubscription) {
+    CatalogSnapshotPtr snapshot = Catalog::getInstance().update(Catalog::CatalogPart_Apps);
+    if (m_enableSubscription && delta && putDeltaResponse(lunaTask, m_appsDeltaLog)) {
+        // only missed deltas are replied
+    } else if (m_enableSubscription && properties.arraySize() == 0) {
+        lunaTask->putSerializedResponse("apps", lunaTask->isDevmodeRequest() ? snapshot->devmodeApps : snapshot->apps);
+    } else if (m_enableSubscription) {
         AppDescriptionList::getInstance().toJson(apps, properties, lunaTask->isDevmodeRequest());
         lunaTask->getResponsePayload().put("apps", apps);
     }
+    lunaTask->getResponsePayload().put("catalogGeneration", (int64_t) snapshot->generation);
 
     if (lunaTask->getRequest().isSubscription()) {
-        lunaTask->getResponsePayload().put("subscribed", LSSubscriptionAdd(this->get(), METHOD_LIST_APPS, lunaTask->getMessage(), nullptr));
+        // Request is parsed only once here. Posts are built per group
+        string subscriptionKey = delta ? toDeltaKey(METHOD_LIST_APPS, lunaTask->isDevmodeRequest())
+                                       : toListAppsKey(properties, lunaTask->isDevmodeRequest());
+        bool subscribed = LSSubscriptionAdd(this->get(), subscriptionKey.c_str(), lunaTask->getMessage(), nullptr);
+        if (subscribed && !delta && m_listAppsGroups.find(subscriptionKey) == m_listAppsGroups.end()) {
+            m_listAppsGroups[subscriptionKey] = { properties, lunaTask->isDevmodeRequest() };
+        }
+        lunaTask->getResponsePayload().put("subscribed", subscribed);
     } else {
         lunaTask->getResponsePayload().put("subscribed", false);
     }
@@ -619,6 +706,7 @@ void ApplicationManager::updateLaunchPoint(LunaTaskPtr lunaTask)
     requestPayload.remove("launchPointId");
     launchPoint->updateDatabase(requestPayload);
     launchPoint->syncDatabase();
+    LaunchPointList::getInstance().reorder(launchPoint);
     LunaTaskList::getInstance().removeAfterReply(std::move(lunaTask));
 }
 
@@ -640,14 +728,26 @@ void ApplicationManager::removeLaunchPoint(LunaTaskPtr lunaTask)
 
 void ApplicationManager::listLaunchPoints(LunaTaskPtr lunaTask)
 {
+    bool delta = false;
+    JValueUtil::getValue(lunaTask->getRequestPayload(), "delta", delta);
+    if (delta && !lunaTask->getRequest().isSubscription()) {
+        lunaTask->setErrCodeAndText(ErrCode_INVALID_PAYLOAD, "delta mode requires subscription");
+        LunaTaskList::getInstance().removeAfterReply(std::move(lunaTask));
+        return;
+    }
+
     // Don't reply 'apps' in listApps during initializaion
-    if (m_enableSubscription) {
-        JValue launchPoints = pbnjson::Array();
-        LaunchPointList::getInstance().toJson(launchPoints);
-        lunaTask->getResponsePayload().put("launchPoints", launchPoints);
+    CatalogSnapshotPtr snapshot = Catalog::getInstance().update(Catalog::CatalogPart_LaunchPoints);
+    if (m_enableSubscription && delta && putDeltaResponse(lunaTask, m_launchPointsDeltaLog)) {
+        // only missed deltas are replied
+    } else if (m_enableSubscription) {
+        lunaTask->putSerializedResponse("launchPoints", snapshot->launchPoints);
     }
+    lunaTask->getResponsePayload().put("catalogGeneration", (int64_t) snapshot->generation);
 
-    if (lunaTask->getRequest().isSubscription())
+    if (delta)
+        lunaTask->getResponsePayload().put("subscribed", LSSubscriptionAdd(this->get(), toDeltaKey(METHOD_LIST_LAUNCHPOINTS, false).c_str(), lunaTask->getMessage(), nullptr));
+    else if (lunaTask->getRequest().isSubscription())
         lunaTask->getResponsePayload().put("subscribed", ApplicationManager::getInstance().m_listLaunchPointsPoint->subscribe(lunaTask->getRequest()));
     else
         lunaTask->getResponsePayload().put("subscribed", false);
@@ -675,6 +775,14 @@ void ApplicationManager::managerInfo(LunaTaskPtr lunaTask)
     LunaTaskList::getInstance().toJson(lunaTasks);
     lunaTask->getResponsePayload().put("lunaTasks", lunaTasks);
 
+    pbnjson::JValue schemaChecker = pbnjson::Object();
+    SchemaChecker::getInstance().toJson(schemaChecker);
+    lunaTask->getResponsePayload().put("schemaChecker", schemaChecker);
+
+    pbnjson::JValue bootTimeline = pbnjson::Object();
+    BootTimeline::getInstance().toJson(bootTimeline);
+    lunaTask->getResponsePayload().put("bootTimeline", bootTimeline);
+
     LunaTaskList::getInstance().removeAfterReply(std::move(lunaTask));
 }
 
@@ -885,6 +993,7 @@ void ApplicationManager::postGetForegroundAppInfo(bool isOverlayEvent)
 
 void ApplicationManager::postListApps(AppDescriptionPtr appDesc, const string& change, const string& changeReason)
 {
+    scheduleSnapshots();
     if (!m_enableSubscription) return;
 
     JValue subscriptionPayload = pbnjson::Object();
@@ -896,66 +1005,91 @@ void ApplicationManager::postListApps(AppDescriptionPtr appDesc, const string& c
     if (!changeReason.empty())
         subscriptionPayload.put("changeReason", changeReason);
 
-    Logger::info(getClassName(), __FUNCTION__, "SubscriptionPost", change);
-    LSSubscriptionIter *iter = NULL;
-    if (!LSSubscriptionAcquire(ApplicationManager::getInstance().get(), METHOD_LIST_APPS, &iter, NULL))
-        return;
-    while (LSSubscriptionHasNext(iter)) {
-        LSMessage* message = LSSubscriptionNext(iter);
-        Message request(message);
-        bool isDevmode = (strcmp(request.getKind(), "/dev/listApps") == 0);
+    int64_t sequence = m_appsDeltaLog.getSequence();
+    if (appDesc == nullptr)
+        AppDescriptionList::getInstance().syncDeltaLog(m_appsDeltaLog);
+    else if (change == "removed")
+        m_appsDeltaLog.remove(appDesc->getAppId());
+    else
+        m_appsDeltaLog.put(appDesc->getAppId(), appDesc->getJson(), appDesc->getSnapshot(), appDesc->isDevmodeApp());
+    postDeltas(METHOD_LIST_APPS, m_appsDeltaLog, sequence);
 
-        if (isDevmode && !SAMConf::getInstance().isDevmodeEnabled()) {
-            Logger::debug(getClassName(), __FUNCTION__, "Devmode is disabled");
-            continue;
-        }
+    // subscriptionPayload is changed for each group. Keep its base here
+    const string basePayload = subscriptionPayload.stringify();
 
-        pbnjson::JValue requestPayload = JDomParser::fromString(request.getPayload(), JValueUtil::getSchema("applicationManager.listApps"));
-        if (requestPayload.isNull()) {
-            Logger::warning(getClassName(), __FUNCTION__, "Failed to parse requestPayload");
+    Logger::info(getClassName(), __FUNCTION__, "SubscriptionPost", change);
+    for (auto it = m_listAppsGroups.begin(); it != m_listAppsGroups.end();) {
+        const string& subscriptionKey = it->first;
+        JValue& properties = it->second.properties;
+        bool isDevmode = it->second.devmode;
+
+        // All subscribers of the group are cancelled
+        if (LSSubscriptionGetHandleSubscribersCount(ApplicationManager::getInstance().get(), subscriptionKey.c_str()) == 0) {
+            it = m_listAppsGroups.erase(it);
             continue;
         }
+        ++it;
 
-        JValue properties = pbnjson::Array();
-        if (JValueUtil::getValue(requestPayload, "properties", properties) && properties.isArray()) {
-            properties.append("id");
+        if (isDevmode && !SAMConf::getInstance().isDevmodeEnabled()) {
+            Logger::debug(getClassName(), __FUNCTION__, "Devmode is disabled");
+            continue;
         }
 
-        if (appDesc == nullptr) {
+        string payload;
+        if (appDesc == nullptr && properties.arraySize() == 0) {
+            payload = basePayload;
+            JValueUtil::putSerialized(payload, "apps", AppDescriptionList::getInstance().getSnapshot(isDevmode));
+        } else if (appDesc == nullptr) {
             pbnjson::JValue apps = pbnjson::Array();
             AppDescriptionList::getInstance().toJson(apps, properties, isDevmode);
             subscriptionPayload.put("apps", apps);
+            payload = subscriptionPayload.stringify();
         } else {
             if (appDesc->isDevmodeApp() != isDevmode) {
                 Logger::debug(getClassName(), __FUNCTION__, "Devmode != DevmodeApp");
                 continue;
             }
-            pbnjson::JValue app = appDesc->getJson(properties);
-            subscriptionPayload.put("app", app);
+            subscriptionPayload.put("app", appDesc->getJson(properties));
+            payload = subscriptionPayload.stringify();
+        }
+
+        if (!LSSubscriptionReply(ApplicationManager::getInstance().get(), subscriptionKey.c_str(), payload.c_str(), NULL)) {
+            Logger::error(getClassName(), __FUNCTION__, subscriptionKey, "Failed to post subscription");
         }
-        Logger::debug(getClassName(), __FUNCTION__, request.getSenderServiceName());
-        request.respond(subscriptionPayload.stringify().c_str());
     }
-    LSSubscriptionRelease(iter);
-    iter = NULL;
+}
+
+string ApplicationManager::toListAppsKey(const JValue& properties, bool devmode)
+{
+    // ex) listApps#Y#["title","id"]
+    string key = string(METHOD_LIST_APPS) + (devmode ? "#Y#" : "#N#");
+    if (properties.arraySize() > 0)
+        key += properties.stringify();
+    return key;
 }
 
 void ApplicationManager::postListLaunchPoints(LaunchPointPtr launchPoint, string change)
 {
+    scheduleSnapshots();
     if (!m_enableSubscription) return;
 
+    // invisible launch points are not listed. Those are same as removed ones for delta subscribers
+    int64_t sequence = m_launchPointsDeltaLog.getSequence();
+    if (launchPoint == nullptr)
+        LaunchPointList::getInstance().syncDeltaLog(m_launchPointsDeltaLog);
+    else if (change == "removed" || !launchPoint->isVisible())
+        m_launchPointsDeltaLog.remove(launchPoint->getLaunchPointId());
+    else
+        m_launchPointsDeltaLog.put(launchPoint->getLaunchPointId(), launchPoint->getJson(), launchPoint->getSnapshot());
+    postDeltas(METHOD_LIST_LAUNCHPOINTS, m_launchPointsDeltaLog, sequence);
+
     if (launchPoint != nullptr && !launchPoint->isVisible())
         return;
 
     pbnjson::JValue subscriptionPayload = pbnjson::Object();
-    pbnjson::JValue json = pbnjson::Object();
 
     if (launchPoint) {
-        launchPoint->toJson(json);
-        subscriptionPayload.put("launchPoint", json);
-    } else {
-        pbnjson::JValue launchPoints = pbnjson::Array();
-        LaunchPointList::getInstance().toJson(launchPoints);
+        subscriptionPayload.put("launchPoint", launchPoint->getJson());
     }
 
     subscriptionPayload.put("subscribed", true);
@@ -964,44 +1098,154 @@ void ApplicationManager::postListLaunchPoints(LaunchPointPtr launchPoint, string
         subscriptionPayload.put("change", change);
 
     Logger::logSubscriptionPost(getClassName(), __FUNCTION__, *m_listLaunchPointsPoint, subscriptionPayload);
-    m_listLaunchPointsPoint->post(subscriptionPayload.stringify().c_str());
+    string payload = subscriptionPayload.stringify();
+    if (launchPoint == nullptr)
+        JValueUtil::putSerialized(payload, "launchPoints", LaunchPointList::getInstance().getSnapshot());
+    m_listLaunchPointsPoint->post(payload.c_str());
 }
 
-void ApplicationManager::postRunning(RunningAppPtr runningApp)
+string ApplicationManager::toRecentsKey(int displayId)
+{
+    string key = METHOD_LIST_RECENTS;
+    if (displayId >= 0)
+        key += "#" + to_string(displayId);
+    return key;
+}
+
+string ApplicationManager::toDeltaKey(const char* method, bool devmode)
 {
-    static JValue prevSubscriptionPayloadAll;
-    static JValue prevSubscriptionPayloadDev;
+    // ex) listApps#N#delta
+    return string(method) + (devmode ? "#Y#" : "#N#") + "delta";
+}
 
-    if (!m_enableSubscription) return;
+bool ApplicationManager::putDeltaResponse(LunaTaskPtr lunaTask, const DeltaLog& deltaLog)
+{
+    int64_t generation = 0;
+    int64_t sequence = 0;
+    JValue deltas = pbnjson::Array();
 
-    pbnjson::JValue subscriptionPayload;
-    if (runningApp != nullptr && runningApp->getLaunchPoint()->getAppDesc()->isDevmodeApp()) {
-        if (RunningAppList::getInstance().isTransition(true))
-            return;
-        subscriptionPayload = pbnjson::Object();
-        makeRunning(subscriptionPayload, true);
-        subscriptionPayload.put("subscribed", true);
+    lunaTask->getResponsePayload().put("generation", deltaLog.getGeneration());
+    lunaTask->getResponsePayload().put("sequence", deltaLog.getSequence());
+
+    if (!JValueUtil::getValue(lunaTask->getRequestPayload(), "generation", generation) ||
+        !JValueUtil::getValue(lunaTask->getRequestPayload(), "sequence", sequence)) {
+        return false;
+    }
+    if (generation != deltaLog.getGeneration() || !deltaLog.getDeltas(sequence, lunaTask->isDevmodeRequest(), deltas)) {
+        Logger::info(getClassName(), __FUNCTION__, lunaTask->getCaller(),
+                     Logger::format("Full snapshot is needed: generation(%lld) sequence(%lld)", (long long) generation, (long long) sequence));
+        return false;
+    }
+    lunaTask->getResponsePayload().put("deltas", deltas);
+    return true;
+}
+
+void ApplicationManager::postDeltas(const char* method, const DeltaLog& deltaLog, int64_t sequence)
+{
+    if (deltaLog.getSequence() == sequence)
+        return;
+
+    for (bool devmode : { false, true }) {
+        string subscriptionKey = toDeltaKey(method, devmode);
+        if (LSSubscriptionGetHandleSubscribersCount(get(), subscriptionKey.c_str()) == 0)
+            continue;
+
+        JValue subscriptionPayload = pbnjson::Object();
         subscriptionPayload.put("returnValue", true);
+        subscriptionPayload.put("subscribed", true);
+        subscriptionPayload.put("generation", deltaLog.getGeneration());
+        subscriptionPayload.put("sequence", deltaLog.getSequence());
 
-        if (subscriptionPayload != prevSubscriptionPayloadDev) {
-            prevSubscriptionPayloadDev = subscriptionPayload.duplicate();
-            Logger::logSubscriptionPost(getClassName(), __FUNCTION__, *m_runningDev, subscriptionPayload);
-            m_runningDev->post(subscriptionPayload.stringify().c_str());
+        string payload;
+        JValue deltas = pbnjson::Array();
+        if (deltaLog.getDeltas(sequence, devmode, deltas)) {
+            if (deltas.arraySize() == 0)
+                continue;
+            subscriptionPayload.put("deltas", deltas);
+            payload = subscriptionPayload.stringify();
+        } else {
+            // Too many deltas are recorded in one post. Subscribers get full snapshot like the first reply
+            Logger::info(getClassName(), __FUNCTION__, subscriptionKey,
+                         Logger::format("Full snapshot is posted: sequence(%lld)", (long long) deltaLog.getSequence()));
+            payload = subscriptionPayload.stringify();
+            if (strcmp(method, METHOD_LIST_APPS) == 0)
+                JValueUtil::putSerialized(payload, "apps", AppDescriptionList::getInstance().getSnapshot(devmode));
+            else
+                JValueUtil::putSerialized(payload, "launchPoints", LaunchPointList::getInstance().getSnapshot());
+        }
+        if (!LSSubscriptionReply(get(), subscriptionKey.c_str(), payload.c_str(), NULL)) {
+            Logger::error(getClassName(), __FUNCTION__, subscriptionKey, "Failed to post subscription");
         }
     }
+}
 
-    if (RunningAppList::getInstance().isTransition(false))
+gboolean ApplicationManager::onIdleSnapshot(gpointer data)
+{
+    ApplicationManager* self = static_cast<ApplicationManager*>(data);
+    self->m_snapshotSource = 0;
+
+    // list snapshots are serialized and published as a new catalog generation
+    Catalog::getInstance().update();
+    return G_SOURCE_REMOVE;
+}
+
+void ApplicationManager::scheduleSnapshots()
+{
+    if (m_snapshotSource > 0)
         return;
+    m_snapshotSource = g_idle_add(onIdleSnapshot, this);
+}
 
-    subscriptionPayload = pbnjson::Object();
-    makeRunning(subscriptionPayload, false);
-    subscriptionPayload.put("subscribed", true);
+void ApplicationManager::postRunning(RunningAppPtr runningApp)
+{
+    if (!m_enableSubscription) return;
+
+    // Same list is not posted again. Version is compared instead of payload
+    RunningAppList& runningAppList = RunningAppList::getInstance();
+    if (runningApp != nullptr && runningApp->isDevmodeApp()) {
+        if (runningAppList.isTransition(true))
+            return;
+        if (m_postedRunningDevVersion != runningAppList.getVersion(true)) {
+            m_postedRunningDevVersion = runningAppList.getVersion(true);
+            string payload = "{\"subscribed\":true,\"returnValue\":true}";
+            JValueUtil::putSerialized(payload, "running", runningAppList.getSnapshot(true));
+            Logger::info(getClassName(), __FUNCTION__, "SubscriptionPost", Logger::format("version(%lu) dev", m_postedRunningDevVersion));
+            m_runningDev->post(payload.c_str());
+        }
+    }
+
+    if (runningAppList.isTransition(false))
+        return;
+    if (m_postedRunningVersion == runningAppList.getVersion(false))
+        return;
+
+    m_postedRunningVersion = runningAppList.getVersion(false);
+    string payload = "{\"subscribed\":true,\"returnValue\":true}";
+    JValueUtil::putSerialized(payload, "running", runningAppList.getSnapshot(false));
+    Logger::info(getClassName(), __FUNCTION__, "SubscriptionPost", Logger::format("version(%lu)", m_postedRunningVersion));
+    m_running->post(payload.c_str());
+}
+
+void ApplicationManager::postListRecents(const JValue& delta)
+{
+    if (!m_enableSubscription) return;
+
+    int displayId = -1;
+    JValueUtil::getValue(delta, "displayId", displayId);
+
+    JValue subscriptionPayload = delta.duplicate();
     subscriptionPayload.put("returnValue", true);
+    subscriptionPayload.put("subscribed", true);
+    string payload = subscriptionPayload.stringify();
 
-    if (subscriptionPayload == prevSubscriptionPayloadAll) return;
-    prevSubscriptionPayloadAll = subscriptionPayload.duplicate();
-    Logger::logSubscriptionPost(getClassName(), __FUNCTION__, *m_running, subscriptionPayload);
-    m_running->post(subscriptionPayload.stringify().c_str());
+    // subscribers of all displays and subscribers of the display
+    for (const string& subscriptionKey : { toRecentsKey(-1), toRecentsKey(displayId) }) {
+        if (LSSubscriptionGetHandleSubscribersCount(get(), subscriptionKey.c_str()) == 0)
+            continue;
+        if (!LSSubscriptionReply(get(), subscriptionKey.c_str(), payload.c_str(), NULL)) {
+            Logger::error(getClassName(), __FUNCTION__, subscriptionKey, "Failed to post subscription");
+        }
+    }
 }
 
 void ApplicationManager::makeGetForegroundAppInfo(JValue& payload)
@@ -20,6 +20,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 #include <boost/function.hpp>
 #include <boost/signals2.hpp>
 #include <pbnjson.hpp>
@@ -35,6 +36,7 @@
 #include "conf/SAMConf.h"
 #include "interface/IClassName.h"
 #include "interface/ISingleton.h"
+#include "util/DeltaLog.h"
 #include "util/Logger.h"
 #include "util/File.h"
 
@@ -61,6 +63,7 @@ public:
     static const char* METHOD_LOCK_APP;
     static const char* METHOD_REGISTER_APP;
     static const char* METHOD_REGISTER_NATIVE_APP;
+    static const char* METHOD_LIST_RECENTS;
 
     static const char* METHOD_LIST_APPS;
     static const char* METHOD_GET_APP_STATUS;
@@ -89,6 +92,7 @@ public:
     void getForegroundAppInfo(LunaTaskPtr lunaTask);
     void lockApp(LunaTaskPtr lunaTask);
     void registerApp(LunaTaskPtr lunaTask);
+    void listRecents(LunaTaskPtr lunaTask);
 
     void listApps(LunaTaskPtr lunaTask);
     void getAppStatus(LunaTaskPtr lunaTask);
@@ -110,11 +114,18 @@ public:
     void postListApps(AppDescriptionPtr appDesc, const string& change, const string& changeReason);
     void postListLaunchPoints(LaunchPointPtr launchPoint, string change);
     void postRunning(RunningAppPtr runningApp);
+    void postListRecents(const JValue& delta);
 
     // make
     void makeGetForegroundAppInfo(JValue& payload);
     void makeRunning(JValue& payload, bool isDevmode);
 
+    // listApps and listLaunchPoints snapshots are serialized and published in Catalog in idle time
+    void scheduleSnapshots();
+
+    // launch requests which are received before their apps are scanned
+    void launchPendings();
+
     void enablePosting()
     {
         if (m_enableSubscription)
@@ -133,7 +144,22 @@ public:
     }
 
 private:
+    // listApps subscribers who requested same properties share one subscription key
+    struct ListAppsGroup {
+        JValue properties;
+        bool devmode;
+    };
+
     static bool onAPICalled(LSHandle* sh, LSMessage* message, void* context);
+    static gboolean onIdleSnapshot(gpointer data);
+    static string toListAppsKey(const JValue& properties, bool devmode);
+    static string toDeltaKey(const char* method, bool devmode);
+    static string toRecentsKey(int displayId);
+
+    // puts 'generation', 'sequence' and missed 'deltas' if the client can continue from its last sequence.
+    // Returns false if full snapshot is needed
+    bool putDeltaResponse(LunaTaskPtr lunaTask, const DeltaLog& deltaLog);
+    void postDeltas(const char* method, const DeltaLog& deltaLog, int64_t sequence);
 
     ApplicationManager();
 
@@ -161,6 +187,20 @@ private:
     LS::SubscriptionPoint* m_runningDev;
 
     bool m_enableSubscription;
+    guint m_snapshotSource;
+    vector<LunaTaskPtr> m_pendingLaunches;
+
+    // version of RunningAppList which is posted last
+    unsigned long m_postedRunningVersion;
+    unsigned long m_postedRunningDevVersion;
+
+    // subscription key => parsed request of listApps subscribers
+    map<string, ListAppsGroup> m_listAppsGroups;
+
+    // for subscribers in delta mode
+    static const size_t DELTA_LOG_CAPACITY = 256;
+    DeltaLog m_appsDeltaLog;
+    DeltaLog m_launchPointsDeltaLog;
 
     // TODO: Following should be deleted
     ApplicationManagerCompat m_compat1;
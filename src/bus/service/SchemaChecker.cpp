@@ -18,9 +18,18 @@
 
 #include "ApplicationManager.h"
 #include "Environment.h"
+#include "util/Logger.h"
+#include "util/Time.h"
 
 SchemaChecker::SchemaChecker()
+    : m_hitCount(0),
+      m_missCount(0),
+      m_validationCount(0),
+      m_validationTime(0),
+      m_maxValidationTime(0)
 {
+    setClassName("SchemaChecker");
+
     m_APISchemaFiles[ApplicationManager::METHOD_LAUNCH] = "applicationManager.launch";
     m_APISchemaFiles[ApplicationManager::METHOD_PAUSE] = "";
     m_APISchemaFiles[ApplicationManager::METHOD_CLOSE] = "";
@@ -31,6 +40,7 @@ SchemaChecker::SchemaChecker()
     m_APISchemaFiles[ApplicationManager::METHOD_GET_FOREGROUND_APPINFO] = "applicationManager.getForegroundAppInfo";
     m_APISchemaFiles[ApplicationManager::METHOD_LOCK_APP] = "applicationManager.lockApp";
     m_APISchemaFiles[ApplicationManager::METHOD_REGISTER_APP] = "applicationManager.registerApp";
+    m_APISchemaFiles[ApplicationManager::METHOD_LIST_RECENTS] = "applicationManager.listRecents";
     m_APISchemaFiles[ApplicationManager::METHOD_LIST_APPS] = "applicationManager.listApps";
     m_APISchemaFiles[ApplicationManager::METHOD_GET_APP_STATUS] = "applicationManager.getAppStatus";
     m_APISchemaFiles[ApplicationManager::METHOD_GET_APP_INFO] = "applicationManager.getAppInfo";
@@ -44,18 +54,70 @@ SchemaChecker::SchemaChecker()
 SchemaChecker::~SchemaChecker()
 {
     m_APISchemaFiles.clear();
+    m_schemas.clear();
+}
+
+void SchemaChecker::initialize()
+{
+    for (const auto& it : m_APISchemaFiles) {
+        if (it.second.empty() || m_schemas.find(it.first) != m_schemas.end())
+            continue;
+        JSchema schema = compile(it.second);
+        if (schema.isInitialized())
+            m_schemas.insert(pair<string, JSchema>(it.first, schema));
+    }
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("schemas(%d)", (int) m_schemas.size()));
 }
 
 JValue SchemaChecker::getRequestPayloadWithSchema(Message& request)
 {
-    string method = request.getMethod();
     JValue requestPayload;
-    if (m_APISchemaFiles.find(method) == m_APISchemaFiles.end() || m_APISchemaFiles[method].empty()) {
+    auto name = m_APISchemaFiles.find(request.getMethod());
+    if (name == m_APISchemaFiles.end() || name->second.empty()) {
         requestPayload = JDomParser::fromString(request.getPayload());
         return requestPayload;
     }
 
-    string path = PATH_SAM_SCHEMAS + m_APISchemaFiles[method] + ".schema";
-    requestPayload = JDomParser::fromString(request.getPayload(), JSchema::fromFile(path.c_str()));
+    auto schema = m_schemas.find(name->first);
+    if (schema != m_schemas.end()) {
+        m_hitCount++;
+    } else {
+        // Missing or invalid schema is not cached. It is read again in next request
+        m_missCount++;
+        JSchema compiled = compile(name->second);
+        if (!compiled.isInitialized()) {
+            requestPayload = JDomParser::fromString(request.getPayload(), compiled);
+            return requestPayload;
+        }
+        schema = m_schemas.insert(pair<string, JSchema>(name->first, compiled)).first;
+    }
+
+    long long start = Time::getCurrentTimeUs();
+    requestPayload = JDomParser::fromString(request.getPayload(), schema->second);
+    long long elapsed = Time::getCurrentTimeUs() - start;
+
+    m_validationCount++;
+    m_validationTime += elapsed;
+    if (elapsed > m_maxValidationTime)
+        m_maxValidationTime = elapsed;
     return requestPayload;
 }
+
+void SchemaChecker::toJson(JValue& json)
+{
+    json.put("schemas", (int) m_schemas.size());
+    json.put("hit", (int64_t) m_hitCount);
+    json.put("miss", (int64_t) m_missCount);
+    json.put("validationCount", (int64_t) m_validationCount);
+    json.put("validationTimeUs", (int64_t) m_validationTime);
+    json.put("maxValidationTimeUs", (int64_t) m_maxValidationTime);
+}
+
+JSchema SchemaChecker::compile(const string& name)
+{
+    string path = PATH_SAM_SCHEMAS + name + ".schema";
+    JSchema schema = JSchema::fromFile(path.c_str());
+    if (!schema.isInitialized())
+        Logger::warning(getClassName(), __FUNCTION__, "Failed to compile " + path);
+    return schema;
+}
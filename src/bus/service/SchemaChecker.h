@@ -22,24 +22,42 @@
 #include <luna-service2/lunaservice.hpp>
 #include <pbnjson.hpp>
 
+#include "interface/IClassName.h"
 #include "interface/ISingleton.h"
 
 using namespace std;
 using namespace LS;
 using namespace pbnjson;
 
-class SchemaChecker : public ISingleton<SchemaChecker> {
+class SchemaChecker : public ISingleton<SchemaChecker>,
+                      public IClassName {
 friend class ISingleton<SchemaChecker>;
 public:
     virtual ~SchemaChecker();
 
+    // compiles all API schemas in advance
+    void initialize();
+
     JValue getRequestPayloadWithSchema(Message& request);
-    string getAPISchemaFilePath(const string& method);
+
+    void toJson(JValue& json);
 
 private:
     SchemaChecker();
 
+    // reads the schema file. Returned schema is not initialized if it is missing or invalid
+    JSchema compile(const string& name);
+
     map<string, string> m_APISchemaFiles;
+    // method => compiled schema
+    map<string, JSchema> m_schemas;
+
+    // statistics
+    long long m_hitCount;
+    long long m_missCount;
+    long long m_validationCount;
+    long long m_validationTime;
+    long long m_maxValidationTime;
 };
 
 #endif /* BUS_SERVICE_SCHEMACHECKER_H_ */
@@ -30,11 +30,36 @@ SAMConf::~SAMConf()
 {
 }
 
+void SAMConf::compileStrings(const JValue& json, const string& key, vector<string>& values)
+{
+    JValue array;
+    if (!JValueUtil::getValue(json, key, array) || !array.isArray())
+        return;
+
+    for (int i = 0; i < array.arraySize(); ++i) {
+        if (array[i].isString())
+            values.push_back(array[i].asString());
+    }
+}
+
+void SAMConf::compileStrings(const JValue& json, const string& key, unordered_set<string>& values)
+{
+    JValue array;
+    if (!JValueUtil::getValue(json, key, array) || !array.isArray())
+        return;
+
+    for (int i = 0; i < array.arraySize(); ++i) {
+        if (array[i].isString())
+            values.insert(array[i].asString());
+    }
+}
+
 void SAMConf::initialize()
 {
     loadReadOnlyConf();
     loadReadWriteConf();
     loadBlockedList();
+    compile();
 
     // TODO this should be moved in RuntimeInfo
     m_isRespawned = File::isFile(this->getRespawnedPath());
@@ -104,3 +129,43 @@ void SAMConf::loadBlockedList()
         Logger::warning(getClassName(), __FUNCTION__, PATH_RO_SAM_CONF, "Failed to parse blocked-file sam-conf");
     }
 }
+
+void SAMConf::compile()
+{
+    Snapshot snapshot;
+
+    JValue applicationPaths;
+    if (JValueUtil::getValue(m_readOnlyDatabase, "ApplicationPaths", applicationPaths) && applicationPaths.isArray()) {
+        for (int i = 0; i < applicationPaths.arraySize(); ++i) {
+            ApplicationPath applicationPath;
+            if (!JValueUtil::getValue(applicationPaths[i], "path", applicationPath.path) ||
+                !JValueUtil::getValue(applicationPaths[i], "typeByDir", applicationPath.typeByDir)) {
+                Logger::warning(getClassName(), __FUNCTION__,
+                                Logger::format("Invalid Configuration: path(%s) typeByDir(%s)", applicationPath.path.c_str(), applicationPath.typeByDir.c_str()));
+                continue;
+            }
+            snapshot.applicationPaths.push_back(std::move(applicationPath));
+        }
+    }
+
+    if (m_readOnlyDatabase.hasKey("CriticalApplicationLocations"))
+        compileStrings(m_readOnlyDatabase, "CriticalApplicationLocations", snapshot.criticalApplicationLocations);
+    else
+        snapshot.criticalApplicationLocations.insert("system_builtin");
+    compileStrings(m_readOnlyDatabase, "FullscreenWindowType", snapshot.fullscreenWindowTypes);
+    compileStrings(m_readOnlyDatabase, "NoJailApps", snapshot.noJailApps);
+
+    compileStrings(m_readOnlyDatabase, "keepAliveApps", snapshot.keepAliveApps);
+    compileStrings(m_readWriteDatabase, "keepAliveApps", snapshot.keepAliveApps);
+    snapshot.keepAliveAppSet.insert(snapshot.keepAliveApps.begin(), snapshot.keepAliveApps.end());
+
+    compileStrings(m_readWriteDatabase, "deletedSystemApps", snapshot.deletedSystemApps);
+    JValueUtil::getValue(m_readWriteDatabase, "language", snapshot.language);
+    JValueUtil::getValue(m_readWriteDatabase, "script", snapshot.script);
+    JValueUtil::getValue(m_readWriteDatabase, "region", snapshot.region);
+    compileStrings(m_readWriteDatabase, "sysAssetFallbackPrecedence", snapshot.sysAssetFallbackPrecedence);
+
+    compileStrings(m_blockedListDatabase, "system.blockedAppList", snapshot.blockedApps);
+
+    m_snapshot = std::move(snapshot);
+}
@@ -18,6 +18,8 @@
 #define __CONF_SAM_FONF_H__
 
 #include <string>
+#include <unordered_set>
+#include <vector>
 #include <pbnjson.hpp>
 
 #include "Environment.h"
@@ -27,6 +29,11 @@
 #include "util/Logger.h"
 #include "util/File.h"
 
+struct ApplicationPath {
+    string path;
+    string typeByDir;
+};
+
 class SAMConf : public ISingleton<SAMConf>,
                 public IClassName {
 friend class ISingleton<SAMConf> ;
@@ -37,11 +44,9 @@ public:
 
     /** READ ONLY CONFIGS **/
 
-    JValue getApplicationPaths()
+    const vector<ApplicationPath>& getApplicationPaths() const
     {
-        JValue ApplicationPaths = pbnjson::Array();
-        JValueUtil::getValue(m_readOnlyDatabase, "ApplicationPaths", ApplicationPaths);
-        return ApplicationPaths;
+        return m_snapshot.applicationPaths;
     }
 
     const string& getAppShellRunnerPath()
@@ -100,62 +105,68 @@ public:
         return RespawnedPath;
     }
 
-    bool isFullscreenWindowTypes(string type)
+    const string& getAppCatalogCachePath()
     {
-        JValue FullscreenWindowType;
-        if (!JValueUtil::getValue(m_readOnlyDatabase, "FullscreenWindowType", FullscreenWindowType) || !FullscreenWindowType.isArray()) {
-            return false;
-        }
-        int size = FullscreenWindowType.arraySize();
-        for (int i = 0; i < size; ++i) {
-            if (FullscreenWindowType[i].asString() == type) {
-                return true;
-            }
-        }
-        return false;
+        static string AppCatalogCachePath = PATH_APP_CATALOG_CACHE;
+        JValueUtil::getValue(m_readOnlyDatabase, "AppCatalogCachePath", AppCatalogCachePath);
+        return AppCatalogCachePath;
     }
 
-    bool isNoJailApp(const string& appId) const
+    const string& getRecentsPath()
     {
-        JValue NoJailApps;
-        if (!JValueUtil::getValue(m_readOnlyDatabase, "NoJailApps", NoJailApps) || !NoJailApps.isArray()) {
-            return false;
-        }
+        static string RecentsPath = PATH_RECENTS;
+        JValueUtil::getValue(m_readOnlyDatabase, "RecentsPath", RecentsPath);
+        return RecentsPath;
+    }
 
-        int size = NoJailApps.arraySize();
-        for (int i = 0; i < size; ++i) {
-            if (NoJailApps[i].asString() == appId) {
-                return true;
-            }
-        }
-        return false;
+    const string& getBootTimelinePath()
+    {
+        // empty means 'do not dump'
+        static string BootTimelinePath = "";
+        JValueUtil::getValue(m_readOnlyDatabase, "BootTimelinePath", BootTimelinePath);
+        return BootTimelinePath;
     }
 
-    /** READ WRIETE CONFIGS **/
+    int getScanWorkerCount() const
+    {
+        // 0 means 'number of online processors'
+        int ScanWorkerCount = 0;
+        JValueUtil::getValue(m_readOnlyDatabase, "ScanWorkerCount", ScanWorkerCount);
+        return ScanWorkerCount;
+    }
 
-    bool isKeepAliveApp(const string& appId) const
+    bool isStagedScanEnabled() const
     {
-        JValue keepAliveApps;
+        bool StagedScan = false;
+        JValueUtil::getValue(m_readOnlyDatabase, "StagedScan", StagedScan);
+        return StagedScan;
+    }
 
-        if (JValueUtil::getValue(m_readOnlyDatabase, "keepAliveApps", keepAliveApps) && keepAliveApps.isArray()) {
-            int size = keepAliveApps.arraySize();
-            for (int i = 0; i < size; ++i) {
-                if (keepAliveApps[i].asString() == appId) {
-                    return true;
-                }
-            }
-        }
+    bool isCriticalApplicationLocation(const string& typeByDir) const
+    {
+        return m_snapshot.criticalApplicationLocations.count(typeByDir) > 0;
+    }
 
-        if (!JValueUtil::getValue(m_readWriteDatabase, "keepAliveApps", keepAliveApps) && keepAliveApps.isArray()) {
-            int size = keepAliveApps.arraySize();
-            for (int i = 0; i < size; ++i) {
-                if (keepAliveApps[i].asString() == appId) {
-                    return true;
-                }
-            }
-        }
+    bool isFullscreenWindowTypes(const string& type) const
+    {
+        return m_snapshot.fullscreenWindowTypes.count(type) > 0;
+    }
 
-        return false;
+    bool isNoJailApp(const string& appId) const
+    {
+        return m_snapshot.noJailApps.count(appId) > 0;
+    }
+
+    /** READ WRIETE CONFIGS **/
+
+    bool isKeepAliveApp(const string& appId) const
+    {
+        return m_snapshot.keepAliveAppSet.count(appId) > 0;
+    }
+
+    void getKeepAliveApps(vector<string>& appIds) const
+    {
+        appIds.insert(appIds.end(), m_snapshot.keepAliveApps.begin(), m_snapshot.keepAliveApps.end());
     }
 
     void setKeepAliveApps(const JValue& array)
@@ -168,43 +179,35 @@ public:
             return;
 
         m_readWriteDatabase.put("keepAliveApps", array);
+        compile();
         saveReadWriteConf();
     }
 
-    JValue getSysAssetFallbackPrecedence() const
+    // AppDescription::scan() can be called by scanning workers.
+    // Those should not touch JValue in database directly.
+    const vector<string>& getSysAssetFallbackPrecedence() const
     {
-        JValue sysAssetFallbackPrecedence = pbnjson::Array();
-        JValueUtil::getValue(m_readWriteDatabase, "sysAssetFallbackPrecedence", sysAssetFallbackPrecedence);
-        return sysAssetFallbackPrecedence;
+        return m_snapshot.sysAssetFallbackPrecedence;
     }
 
-    void setSysAssetFallbackPrecedence(const JValue& array)
+    bool setSysAssetFallbackPrecedence(const JValue& array)
     {
         if (!array.isArray())
-            return;
+            return false;
 
         JValue sysAssetFallbackPrecedence;
         if (JValueUtil::getValue(m_readWriteDatabase, "sysAssetFallbackPrecedence", sysAssetFallbackPrecedence) && sysAssetFallbackPrecedence == array)
-            return;
+            return false;
 
         m_readWriteDatabase.put("sysAssetFallbackPrecedence", array);
+        compile();
         saveReadWriteConf();
+        return true;
     }
 
     bool isDeletedSystemApp(const string& appId) const
     {
-        JValue deletedSystemApps;
-        if (!JValueUtil::getValue(m_readWriteDatabase, "deletedSystemApps", deletedSystemApps) || !deletedSystemApps.isArray()) {
-            return false;
-        }
-
-        int size = deletedSystemApps.arraySize();
-        for (int i = 0; i < size; ++i) {
-            if (deletedSystemApps[i].asString() == appId) {
-                return true;
-            }
-        }
-        return false;
+        return m_snapshot.deletedSystemApps.count(appId) > 0;
     }
 
     void appendDeletedSystemApp(const string& appId)
@@ -218,28 +221,23 @@ public:
             m_readWriteDatabase.put("deletedSystemApps", pbnjson::Array());
         }
         m_readWriteDatabase["deletedSystemApps"].append(appId);
+        compile();
         saveReadWriteConf();
     }
 
     const string& getLanguage() const
     {
-        static string language = "";
-        JValueUtil::getValue(m_readWriteDatabase, "language", language);
-        return language;
+        return m_snapshot.language;
     }
 
     const string& getScript() const
     {
-        static string script = "";
-        JValueUtil::getValue(m_readWriteDatabase, "script", script);
-        return script;
+        return m_snapshot.script;
     }
 
     const string& getRegion() const
     {
-        static string region = "";
-        JValueUtil::getValue(m_readWriteDatabase, "region", region);
-        return region;
+        return m_snapshot.region;
     }
 
     void setLocale(const string& language, const string& script, const string& region)
@@ -249,23 +247,13 @@ public:
         m_readWriteDatabase.put("language", language);
         m_readWriteDatabase.put("script", script);
         m_readWriteDatabase.put("region", region);
+        compile();
         saveReadWriteConf();
     }
 
     bool isBlockedApp(const string& appId) const
     {
-        JValue blockedAppList;
-        if (!JValueUtil::getValue(m_blockedListDatabase, "system.blockedAppList", blockedAppList) || !blockedAppList.isArray()) {
-            return false;
-        }
-
-        int size = blockedAppList.arraySize();
-        for (int i = 0; i < size; ++i) {
-            if (blockedAppList[i].asString() == appId) {
-                return true;
-            }
-        }
-        return false;
+        return m_snapshot.blockedApps.count(appId) > 0;
     }
 
     bool isRespawned()
@@ -298,15 +286,45 @@ public:
 private:
     SAMConf();
 
+    // Typed values of all databases. Frequent checks don't need to touch JValue.
+    // It is replaced as a whole whenever one of databases is changed.
+    struct Snapshot {
+        // read-only database
+        vector<ApplicationPath> applicationPaths;
+        unordered_set<string> criticalApplicationLocations;
+        unordered_set<string> fullscreenWindowTypes;
+        unordered_set<string> noJailApps;
+
+        // read-only and read-write databases
+        vector<string> keepAliveApps;
+        unordered_set<string> keepAliveAppSet;
+
+        // read-write database
+        unordered_set<string> deletedSystemApps;
+        string language;
+        string script;
+        string region;
+        vector<string> sysAssetFallbackPrecedence;
+
+        // blocked-list database
+        unordered_set<string> blockedApps;
+    };
+
+    static void compileStrings(const JValue& json, const string& key, vector<string>& values);
+    static void compileStrings(const JValue& json, const string& key, unordered_set<string>& values);
+
     void loadReadOnlyConf();
     void loadReadWriteConf();
     void saveReadWriteConf();
     void loadBlockedList();
+    void compile();
 
     JValue m_readOnlyDatabase;
     JValue m_readWriteDatabase;
     JValue m_blockedListDatabase;
 
+    Snapshot m_snapshot;
+
     bool m_isRespawned;
     bool m_isDevmodeEnabled;
     bool m_isJailerDisabled;
@@ -0,0 +1,141 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "BootTimeline.h"
+
+#include "util/File.h"
+#include "util/Logger.h"
+#include "util/Time.h"
+
+BootTimeline::BootTimeline()
+    : m_isCompleted(false)
+{
+    setClassName("BootTimeline");
+    m_origin = Time::getCurrentTimeUs();
+}
+
+BootTimeline::~BootTimeline()
+{
+}
+
+void BootTimeline::begin(const string& name)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_isCompleted)
+        return;
+
+    long long time = now();
+    auto it = m_index.find(name);
+    if (it != m_index.end()) {
+        m_phases[it->second].begin = time;
+        m_phases[it->second].end = -1;
+        return;
+    }
+    m_index[name] = m_phases.size();
+    m_phases.push_back({ name, time, -1 });
+}
+
+void BootTimeline::end(const string& name)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_isCompleted)
+        return;
+
+    long long time = now();
+    auto it = m_index.find(name);
+    if (it == m_index.end()) {
+        m_index[name] = m_phases.size();
+        m_phases.push_back({ name, time, time });
+        return;
+    }
+    m_phases[it->second].end = time;
+}
+
+void BootTimeline::mark(const string& name)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_isCompleted || m_index.find(name) != m_index.end())
+        return;
+
+    long long time = now();
+    m_index[name] = m_phases.size();
+    m_phases.push_back({ name, time, time });
+}
+
+void BootTimeline::addApp(const string& appId, const string& folderPath, long long begin, long long end)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_isCompleted)
+        return;
+
+    m_apps.push_back({ appId, folderPath, begin - m_origin, end - m_origin });
+}
+
+void BootTimeline::complete(const string& dumpPath)
+{
+    mark("complete");
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_isCompleted)
+            return;
+        m_isCompleted = true;
+    }
+    Logger::info(getClassName(), __FUNCTION__, Logger::format("Boot is completed in %lld us", now()));
+
+    if (dumpPath.empty())
+        return;
+
+    JValue json = pbnjson::Object();
+    toJson(json);
+    if (!File::writeFile(dumpPath, json.stringify("    ")))
+        Logger::warning(getClassName(), __FUNCTION__, dumpPath, "Failed to dump boot timeline");
+}
+
+void BootTimeline::toJson(JValue& json)
+{
+    lock_guard<mutex> lock(m_mutex);
+    JValue phases = pbnjson::Array();
+    for (const auto& phase : m_phases) {
+        JValue item = pbnjson::Object();
+        item.put("name", phase.name);
+        item.put("begin", (int64_t) phase.begin);
+        if (phase.end >= 0) {
+            item.put("end", (int64_t) phase.end);
+            item.put("duration", (int64_t) (phase.end - phase.begin));
+        }
+        phases.append(item);
+    }
+
+    JValue apps = pbnjson::Array();
+    for (const auto& app : m_apps) {
+        JValue item = pbnjson::Object();
+        item.put("appId", app.appId);
+        item.put("folderPath", app.folderPath);
+        item.put("begin", (int64_t) app.begin);
+        item.put("duration", (int64_t) (app.end - app.begin));
+        apps.append(item);
+    }
+
+    json.put("unit", "us");
+    json.put("completed", m_isCompleted);
+    json.put("phases", phases);
+    json.put("apps", apps);
+}
+
+long long BootTimeline::now()
+{
+    return Time::getCurrentTimeUs() - m_origin;
+}
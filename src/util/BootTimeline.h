@@ -0,0 +1,84 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UTIL_BOOTTIMELINE_H_
+#define UTIL_BOOTTIMELINE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <pbnjson.hpp>
+
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+using namespace pbnjson;
+
+// BootTimeline records monotonic timestamps (in microseconds from process start)
+// of each boot phase until 'complete' is called.
+class BootTimeline : public ISingleton<BootTimeline>,
+                     public IClassName {
+friend class ISingleton<BootTimeline>;
+public:
+    virtual ~BootTimeline();
+
+    void begin(const string& name);
+    void end(const string& name);
+    void mark(const string& name);
+
+    // can be called by scanning workers
+    void addApp(const string& appId, const string& folderPath, long long begin, long long end);
+
+    void complete(const string& dumpPath);
+
+    bool isCompleted() const
+    {
+        return m_isCompleted;
+    }
+
+    void toJson(JValue& json);
+
+private:
+    struct Phase {
+        string name;
+        long long begin;
+        long long end;
+    };
+
+    struct App {
+        string appId;
+        string folderPath;
+        long long begin;
+        long long end;
+    };
+
+    BootTimeline();
+
+    long long now();
+
+    long long m_origin;
+    bool m_isCompleted;
+
+    vector<Phase> m_phases;
+    // name => index of m_phases
+    map<string, size_t> m_index;
+    vector<App> m_apps;
+    mutex m_mutex;
+};
+
+#endif /* UTIL_BOOTTIMELINE_H_ */
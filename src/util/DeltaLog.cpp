@@ -0,0 +1,162 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util/DeltaLog.h"
+
+#include <sys/time.h>
+
+#include "util/JValueUtil.h"
+#include "util/Logger.h"
+
+DeltaLog::DeltaLog(const string& name, size_t capacity)
+    : m_capacity(capacity),
+      m_generation(0),
+      m_sequence(0)
+{
+    setClassName(name);
+
+    // generation starts from current time. So it is not overlapped with previous process
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    m_generation = (int64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+DeltaLog::~DeltaLog()
+{
+}
+
+bool DeltaLog::put(const string& id, const JValue& item, const string& serialized, bool devmode)
+{
+    auto it = m_states.find(id);
+    if (it == m_states.end()) {
+        m_states[id] = { serialized, devmode, true };
+        JValue json = pbnjson::Object();
+        json.put("item", item.duplicate());
+        record("added", id, devmode, json);
+        return true;
+    }
+
+    State& state = it->second;
+    state.isSynced = true;
+    if (state.serialized == serialized && state.devmode == devmode)
+        return false;
+
+    // devmode subscribers should see this as new item
+    if (state.devmode != devmode) {
+        record("removed", id, state.devmode, pbnjson::Object());
+        state.serialized = serialized;
+        state.devmode = devmode;
+        JValue json = pbnjson::Object();
+        json.put("item", item.duplicate());
+        record("added", id, devmode, json);
+        return true;
+    }
+
+    JValue prev = JDomParser::fromString(state.serialized);
+    JValue set = pbnjson::Object();
+    JValue unset = pbnjson::Array();
+    diff(prev, item, set, unset);
+    state.serialized = serialized;
+
+    JValue json = pbnjson::Object();
+    json.put("set", set);
+    if (unset.arraySize() > 0)
+        json.put("unset", unset);
+    record("updated", id, devmode, json);
+    return true;
+}
+
+bool DeltaLog::remove(const string& id)
+{
+    auto it = m_states.find(id);
+    if (it == m_states.end())
+        return false;
+
+    bool devmode = it->second.devmode;
+    m_states.erase(it);
+    record("removed", id, devmode, pbnjson::Object());
+    return true;
+}
+
+void DeltaLog::beginSync()
+{
+    for (auto& state : m_states) {
+        state.second.isSynced = false;
+    }
+}
+
+void DeltaLog::endSync()
+{
+    vector<string> removed;
+    for (const auto& state : m_states) {
+        if (!state.second.isSynced)
+            removed.push_back(state.first);
+    }
+    for (const auto& id : removed) {
+        remove(id);
+    }
+}
+
+bool DeltaLog::getDeltas(int64_t sequence, bool devmode, JValue& deltas) const
+{
+    if (sequence > m_sequence)
+        return false;
+    // 'sequence + 1' should be kept at least
+    if (sequence < m_sequence && (m_deltas.empty() || m_deltas.front().sequence > sequence + 1))
+        return false;
+
+    for (const auto& delta : m_deltas) {
+        if (delta.sequence <= sequence)
+            continue;
+        if (devmode && !delta.devmode)
+            continue;
+        deltas.append(delta.json);
+    }
+    return true;
+}
+
+void DeltaLog::diff(const JValue& prev, const JValue& curr, JValue& set, JValue& unset)
+{
+    if (!prev.isObject()) {
+        for (JValue::KeyValue obj : curr.children()) {
+            set.put(obj.first.asString(), obj.second);
+        }
+        return;
+    }
+
+    for (JValue::KeyValue obj : curr.children()) {
+        string key = obj.first.asString();
+        if (!prev.hasKey(key) || prev[key] != obj.second)
+            set.put(key, obj.second);
+    }
+    for (JValue::KeyValue obj : prev.children()) {
+        if (!curr.hasKey(obj.first.asString()))
+            unset.append(obj.first);
+    }
+}
+
+void DeltaLog::record(const string& change, const string& id, bool devmode, JValue json)
+{
+    json.put("sequence", ++m_sequence);
+    json.put("change", change);
+    json.put("id", id);
+
+    m_deltas.push_back({ m_sequence, devmode, json });
+    while (m_deltas.size() > m_capacity) {
+        m_deltas.pop_front();
+    }
+    Logger::debug(getClassName(), __FUNCTION__, id, Logger::format("sequence(%lld) change(%s)", (long long) m_sequence, change.c_str()));
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UTIL_DELTALOG_H_
+#define UTIL_DELTALOG_H_
+
+#include <deque>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <pbnjson.hpp>
+
+#include "interface/IClassName.h"
+
+using namespace std;
+using namespace pbnjson;
+
+// DeltaLog keeps the last posted state of each item and records its changes as deltas.
+// Each delta has monotonically increasing 'sequence'. Only recent deltas are kept.
+// 'generation' is unique per process. Clients with other generation need full snapshot again.
+//
+// delta) {"sequence": 10, "change": "added", "id": "com.webos.app.test", "item": {...}}
+//        {"sequence": 11, "change": "updated", "id": "com.webos.app.test", "set": {...}, "unset": [...]}
+//        {"sequence": 12, "change": "removed", "id": "com.webos.app.test"}
+class DeltaLog : public IClassName {
+public:
+    DeltaLog(const string& name, size_t capacity);
+    virtual ~DeltaLog();
+
+    // Records 'added' or 'updated' delta if the item is changed. Returns true if it is recorded
+    bool put(const string& id, const JValue& item, const string& serialized, bool devmode = false);
+    bool remove(const string& id);
+
+    // Items which are not put between 'beginSync' and 'endSync' are removed
+    void beginSync();
+    void endSync();
+
+    // Appends deltas after 'sequence'. Only deltas of devmode items are appended if 'devmode' is true.
+    // Returns false if some of those are already discarded.
+    bool getDeltas(int64_t sequence, bool devmode, JValue& deltas) const;
+
+    int64_t getGeneration() const
+    {
+        return m_generation;
+    }
+
+    int64_t getSequence() const
+    {
+        return m_sequence;
+    }
+
+private:
+    struct State {
+        string serialized;
+        bool devmode;
+        bool isSynced;
+    };
+
+    struct Delta {
+        int64_t sequence;
+        bool devmode;
+        JValue json;
+    };
+
+    static void diff(const JValue& prev, const JValue& curr, JValue& set, JValue& unset);
+
+    void record(const string& change, const string& id, bool devmode, JValue json);
+
+    size_t m_capacity;
+    int64_t m_generation;
+    int64_t m_sequence;
+
+    // id => last posted state
+    unordered_map<string, State> m_states;
+    deque<Delta> m_deltas;
+};
+
+#endif /* UTIL_DELTALOG_H_ */
@@ -16,11 +16,23 @@
 
 #include "File.h"
 
+#include <algorithm>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #include <glib.h>
 
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
 void File::set_slash_to_base_path(string& path)
 {
     if (!path.empty() && path[path.length() - 1] == '/')
@@ -101,6 +113,15 @@ bool File::isDirectory(const string& path)
     return true;
 }
 
+bool File::isDirectoryAt(int dirFd, const string& name)
+{
+    struct stat dirStat;
+    if (fstatat(dirFd, name.c_str(), &dirStat, 0) != 0) {
+        return false;
+    }
+    return S_ISDIR(dirStat.st_mode);
+}
+
 bool File::isFile(const string& path)
 {
     struct stat fileStat;
@@ -111,6 +132,52 @@ bool File::isFile(const string& path)
     return true;
 }
 
+int File::openDirectory(const string& path)
+{
+    return open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+}
+
+bool File::listDirectories(const string& path, vector<string>& names)
+{
+    int fd = openDirectory(path);
+    if (fd < 0)
+        return false;
+
+    char buffer[16384] __attribute__ ((aligned(__alignof__(struct linux_dirent64))));
+    while (true) {
+        long length = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+        if (length == 0)
+            break;
+        // partial list should not be used as complete one
+        if (length < 0) {
+            close(fd);
+            return false;
+        }
+
+        for (long offset = 0; offset < length;) {
+            struct linux_dirent64* entry = reinterpret_cast<struct linux_dirent64*>(buffer + offset);
+            offset += entry->d_reclen;
+
+            if (entry->d_name[0] == '.')
+                continue;
+
+            // Only symlinks and filesystems without d_type need stat
+            if (entry->d_type == DT_UNKNOWN || entry->d_type == DT_LNK) {
+                if (!isDirectoryAt(fd, entry->d_name))
+                    continue;
+            } else if (entry->d_type != DT_DIR) {
+                continue;
+            }
+            names.push_back(entry->d_name);
+        }
+    }
+    close(fd);
+
+    // Same order with scandir(alphasort) in "C" locale
+    sort(names.begin(), names.end());
+    return true;
+}
+
 bool File::makeDirectory(const string& path)
 {
     if (g_mkdir_with_parents(path.c_str(), 0700) == 0)
@@ -21,6 +21,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -34,7 +35,13 @@ public:
     static bool concatToFilename(const string originPath, string& returnPath, const string addingStr);
 
     static bool isDirectory(const string& path);
+    // 'name' is resolved relative to dirFd with fstatat
+    static bool isDirectoryAt(int dirFd, const string& name);
     static bool isFile(const string& path);
+    // Lists names of sub directories (sorted, without hidden ones) with getdents64
+    // Opens the directory for '*At' functions. Returns -1 if it fails
+    static int openDirectory(const string& path);
+    static bool listDirectories(const string& path, vector<string>& names);
     static bool makeDirectory(const string& path);
     static bool createFile(const string& path);
     static bool deleteFile(const string& path);
@@ -29,6 +29,27 @@ void JValueUtil::addUniqueItemToArray(pbnjson::JValue& array, string& item)
     array.append(item);
 }
 
+void JValueUtil::putSerialized(string& object, const string& key, const string& serialized)
+{
+    size_t end = object.find_last_of('}');
+    if (end == string::npos)
+        return;
+
+    // 'serialized' can be whole catalog. It is copied only once into 'object'
+    size_t last = object.find_last_not_of(" \t\n", end - 1);
+    bool needComma = last != string::npos && object[last] != '{';
+    string tail = object.substr(end);
+    object.resize(end);
+    object.reserve(end + key.size() + serialized.size() + tail.size() + 4);
+    if (needComma)
+        object += ",";
+    object += "\"";
+    object += key;
+    object += "\":";
+    object += serialized;
+    object += tail;
+}
+
 JSchema JValueUtil::getSchema(string name)
 {
     if (name.empty())
@@ -75,6 +96,17 @@ bool JValueUtil::convertValue(const JValue& json, int& value)
     return true;
 }
 
+bool JValueUtil::convertValue(const JValue& json, int64_t& value)
+{
+    if (!json.isNumber())
+        return false;
+    if (json.asNumber<int64_t>(value) != CONV_OK) {
+        value = 0;
+        return false;
+    }
+    return true;
+}
+
 bool JValueUtil::convertValue(const JValue& json, bool& value)
 {
     if (!json.isBoolean())
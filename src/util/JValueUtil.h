@@ -29,6 +29,10 @@ public:
     static void addUniqueItemToArray(JValue& arr, string& str);
     static JSchema getSchema(string name);
 
+    // puts already serialized value into serialized object.
+    // 'key' is not checked. It should not exist in 'object' already, or the object has duplicated keys
+    static void putSerialized(string& object, const string& key, const string& serialized);
+
     template <typename T>
     static bool getValue(const JValue& json, const string& key, T& value) {
         if (!json)
@@ -59,6 +63,7 @@ private:
     static bool convertValue(const JValue& json, JValue& value);
     static bool convertValue(const JValue& json, string& value);
     static bool convertValue(const JValue& json, int& value);
+    static bool convertValue(const JValue& json, int64_t& value);
     static bool convertValue(const JValue& json, bool& value);
 
 private:
@@ -57,7 +57,8 @@ public:
     template<typename ... Args>
     static const string format(const string& format, Args ... args)
     {
-        static char buffer[1024];
+        // Don't use static buffer. It can be called by scanning workers
+        char buffer[1024];
         snprintf(buffer, 1024, format.c_str(), args ... );
         return string(buffer);
     }
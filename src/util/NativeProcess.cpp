@@ -89,7 +89,7 @@ void NativeProcess::closeStdFd()
         close(m_stdFd);
 }
 
-bool NativeProcess::run()
+bool NativeProcess::run(GPid& pid)
 {
     const char* argv[MAX_ARGS] = { 0, };
     const char* envp[MAX_ENVP] = { 0, };
@@ -119,7 +119,7 @@ bool NativeProcess::run()
         G_SPAWN_DO_NOT_REAP_CHILD,
         prepareSpawn,
         this,
-        &m_pid,
+        &pid,
         -1,
         m_stdFd,
         m_stdFd,
@@ -131,7 +131,7 @@ bool NativeProcess::run()
         gerr = NULL;
         return false;
     }
-    if (!result || m_pid <= 0) {
+    if (!result || pid <= 0) {
         Logger::error(CLASS_NAME, __FUNCTION__, "Failed to folk child process");
         return false;
     }
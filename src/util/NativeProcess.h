@@ -64,7 +64,8 @@ public:
 
     void closeStdFd();
 
-    bool run();
+    // pid is returned instead of stored. RunningApp::setProcessId() stores it
+    bool run(GPid& pid);
     bool term();
     bool kill();
 
@@ -0,0 +1,49 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util/SymbolTable.h"
+
+SymbolTable::SymbolTable()
+{
+    setClassName("SymbolTable");
+
+    auto it = m_symbols.emplace("", SYMBOL_NONE).first;
+    m_strings.push_back(&it->first);
+}
+
+SymbolTable::~SymbolTable()
+{
+}
+
+Symbol SymbolTable::intern(const string& str)
+{
+    auto it = m_symbols.find(str);
+    if (it != m_symbols.end())
+        return it->second;
+
+    Symbol symbol = (Symbol) m_strings.size();
+    it = m_symbols.emplace(str, symbol).first;
+    m_strings.push_back(&it->first);
+    return symbol;
+}
+
+Symbol SymbolTable::find(const string& str) const
+{
+    auto it = m_symbols.find(str);
+    if (it == m_symbols.end())
+        return SYMBOL_NONE;
+    return it->second;
+}
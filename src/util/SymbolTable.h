@@ -0,0 +1,71 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UTIL_SYMBOLTABLE_H_
+#define UTIL_SYMBOLTABLE_H_
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+
+// Interned identifier. Equal strings always have the same symbol
+typedef uint32_t Symbol;
+const Symbol SYMBOL_NONE = 0;
+
+// SymbolTable interns identifiers (appId, launchPointId) into 32-bit symbols.
+// Interned strings are never released. So their references are stable and
+// symbols can be used as keys instead of strings.
+// This should be used in main thread only.
+class SymbolTable : public ISingleton<SymbolTable>,
+                    public IClassName {
+friend class ISingleton<SymbolTable>;
+public:
+    virtual ~SymbolTable();
+
+    // returns existing symbol or creates new one. Empty string is SYMBOL_NONE
+    Symbol intern(const string& str);
+
+    // returns SYMBOL_NONE if the string is not interned yet
+    Symbol find(const string& str) const;
+
+    const string& toString(Symbol symbol) const
+    {
+        if (symbol >= m_strings.size())
+            return *m_strings[SYMBOL_NONE];
+        return *m_strings[symbol];
+    }
+
+    size_t size() const
+    {
+        return m_strings.size() - 1;
+    }
+
+private:
+    SymbolTable();
+
+    // nodes of unordered_map are not moved during rehash
+    unordered_map<string, Symbol> m_symbols;
+    // symbol => key of m_symbols
+    vector<const string*> m_strings;
+};
+
+#endif /* UTIL_SYMBOLTABLE_H_ */
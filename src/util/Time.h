@@ -24,6 +24,7 @@ using namespace std;
 class Time {
 public:
     static long long getCurrentTime();
+    static long long getCurrentTimeUs();
     static string generateUid();
 
     Time();
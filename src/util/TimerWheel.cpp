@@ -0,0 +1,167 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "util/TimerWheel.h"
+
+WheelTimer::WheelTimer(GSourceFunc callback, gpointer data)
+    : m_callback(callback),
+      m_data(data),
+      m_timeout(0),
+      m_rounds(0),
+      m_head(nullptr),
+      m_prev(nullptr),
+      m_next(nullptr)
+{
+}
+
+WheelTimer::~WheelTimer()
+{
+    stop();
+    if (TimerWheel::s_dispatching == this)
+        TimerWheel::s_dispatching = nullptr;
+}
+
+void WheelTimer::start(guint timeout)
+{
+    stop();
+    m_timeout = timeout;
+    TimerWheel::getInstance().add(this);
+}
+
+void WheelTimer::stop()
+{
+    if (!isActive())
+        return;
+    TimerWheel::getInstance().remove(this);
+}
+
+WheelTimer* TimerWheel::s_dispatching = nullptr;
+
+gboolean TimerWheel::onTick(gpointer data)
+{
+    TimerWheel* self = static_cast<TimerWheel*>(data);
+    self->advance();
+    if (self->m_count > 0)
+        return G_SOURCE_CONTINUE;
+
+    self->m_source = 0;
+    return G_SOURCE_REMOVE;
+}
+
+void TimerWheel::link(WheelTimer** head, WheelTimer* timer)
+{
+    timer->m_head = head;
+    timer->m_prev = nullptr;
+    timer->m_next = *head;
+    if (*head)
+        (*head)->m_prev = timer;
+    *head = timer;
+}
+
+void TimerWheel::unlink(WheelTimer* timer)
+{
+    if (timer->m_prev)
+        timer->m_prev->m_next = timer->m_next;
+    else
+        *(timer->m_head) = timer->m_next;
+    if (timer->m_next)
+        timer->m_next->m_prev = timer->m_prev;
+
+    timer->m_head = nullptr;
+    timer->m_prev = nullptr;
+    timer->m_next = nullptr;
+}
+
+TimerWheel::TimerWheel()
+    : m_slots(SLOTS, nullptr),
+      m_expired(nullptr),
+      m_cursor(0),
+      m_source(0),
+      m_lastTick(0),
+      m_count(0)
+{
+    setClassName("TimerWheel");
+}
+
+TimerWheel::~TimerWheel()
+{
+    if (m_source > 0)
+        g_source_remove(m_source);
+}
+
+void TimerWheel::add(WheelTimer* timer)
+{
+    gint64 now = g_get_monotonic_time();
+    if (m_source == 0)
+        m_lastTick = now;
+
+    // Slots are counted from the last tick. Elapsed time in current tick is added not to expire early
+    gint64 elapsed = (now - m_lastTick + 999) / 1000;
+    guint ticks = (elapsed + timer->m_timeout + TICK - 1) / TICK;
+    if (ticks == 0)
+        ticks = 1;
+    // the slot at distance 'ticks' is checked after 'rounds' more turns
+    timer->m_rounds = (ticks - 1) / SLOTS;
+    link(&m_slots[(m_cursor + ticks) % SLOTS], timer);
+
+    m_count++;
+    if (m_source == 0)
+        m_source = g_timeout_add(TICK, onTick, this);
+}
+
+void TimerWheel::remove(WheelTimer* timer)
+{
+    unlink(timer);
+    m_count--;
+}
+
+void TimerWheel::advance()
+{
+    // GSource can be dispatched late. Missed ticks are caught up here
+    gint64 now = g_get_monotonic_time();
+    gint64 ticks = (now - m_lastTick) / (TICK * 1000);
+    if (ticks <= 0)
+        return;
+    m_lastTick += ticks * TICK * 1000;
+
+    while (ticks-- > 0) {
+        m_cursor = (m_cursor + 1) % SLOTS;
+        WheelTimer* timer = m_slots[m_cursor];
+        while (timer) {
+            WheelTimer* next = timer->m_next;
+            if (timer->m_rounds > 0) {
+                timer->m_rounds--;
+            } else {
+                unlink(timer);
+                link(&m_expired, timer);
+            }
+            timer = next;
+        }
+    }
+
+    // Callbacks can stop or destroy other expired timers. Those are unlinked from m_expired
+    while (m_expired) {
+        WheelTimer* timer = m_expired;
+        unlink(timer);
+        m_count--;
+
+        s_dispatching = timer;
+        gboolean result = timer->m_callback(timer->m_data);
+        if (s_dispatching && result == G_SOURCE_CONTINUE && !timer->isActive())
+            add(timer);
+        s_dispatching = nullptr;
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 LG Electronics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UTIL_TIMERWHEEL_H_
+#define UTIL_TIMERWHEEL_H_
+
+#include <vector>
+#include <glib.h>
+
+#include "interface/IClassName.h"
+#include "interface/ISingleton.h"
+
+using namespace std;
+
+class TimerWheel;
+
+// WheelTimer is owned by its user and is stopped when it is destroyed.
+// If callback returns G_SOURCE_CONTINUE, it is started again with same timeout.
+class WheelTimer {
+friend class TimerWheel;
+public:
+    WheelTimer(GSourceFunc callback, gpointer data);
+    virtual ~WheelTimer();
+
+    // timeout is milliseconds. Running timer is restarted
+    void start(guint timeout);
+    void stop();
+
+    bool isActive() const
+    {
+        return m_head != nullptr;
+    }
+
+private:
+    WheelTimer(const WheelTimer&);
+    WheelTimer& operator=(const WheelTimer&) const;
+
+    GSourceFunc m_callback;
+    gpointer m_data;
+    guint m_timeout;
+    guint m_rounds;
+
+    // list which the timer is linked in. nullptr means inactive
+    WheelTimer** m_head;
+    WheelTimer* m_prev;
+    WheelTimer* m_next;
+};
+
+// TimerWheel owns all WheelTimers with one GSource.
+// Timers are hashed into slots by their deadlines. Start and stop are O(1) and
+// all timers in a slot are expired in one dispatch. Deadlines are rounded up to TICK.
+// The GSource exists only while there are active timers.
+class TimerWheel : public ISingleton<TimerWheel>,
+                   public IClassName {
+friend class ISingleton<TimerWheel>;
+friend class WheelTimer;
+public:
+    virtual ~TimerWheel();
+
+private:
+    static const guint TICK = 100; // 0.1 second
+    static const guint SLOTS = 128; // 12.8 seconds per round
+
+    // timer in callback. It becomes nullptr if the timer is destroyed in its callback.
+    // It is static because timers in other singletons can be destroyed after TimerWheel
+    static WheelTimer* s_dispatching;
+
+    static gboolean onTick(gpointer data);
+
+    static void link(WheelTimer** head, WheelTimer* timer);
+    static void unlink(WheelTimer* timer);
+
+    TimerWheel();
+
+    void add(WheelTimer* timer);
+    void remove(WheelTimer* timer);
+    void advance();
+
+    vector<WheelTimer*> m_slots;
+    // expired timers which are not dispatched yet
+    WheelTimer* m_expired;
+    guint m_cursor;
+    guint m_source;
+    gint64 m_lastTick;
+    int m_count;
+};
+
+#endif /* UTIL_TIMERWHEEL_H_ */